@@ -0,0 +1,392 @@
+#pragma once
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Keeps the chunks of a memory-mapped world near the player resident. A chunk
+// is one tile of a tiled map file: the same chunkBytes long range in every
+// layer, chunk n starting at n * chunkBytes. The streaming thread faults chunks
+// in ahead of the player, nearest first and then along the direction of
+// movement, and once more than budget are resident hands the least recently
+// wanted back to the OS. Render threads then rarely wait on the disk.
+//
+// Rays also fault in pages the streamer never loaded, such as a long view past
+// the prefetched chunks. Those are not tracked one by one. Instead, every
+// sweepMs the streamer hands back everything it is not tracking and that is
+// not pinned. Memory then stays near budget plus what a second of rendering
+// touches, however big the file is.
+struct ChunkStreamer
+{
+    uint8_t *layers[3] = {};
+    int layerCount = 0;
+    size_t chunkBytes = 0;
+    int chunksX = 0, chunksY = 0;
+    int radius = 2;    // chunks kept in every direction around the player
+    int lookahead = 4; // chunks prefetched along the direction of movement
+    int budget = 1024; // resident chunks before the least recently wanted go
+    int sweepMs = 1000; // how often untracked pages are handed back
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool running = false;
+    bool stopping = false;
+    bool moved = false;
+
+    // Posted by the game, in chunks.
+    float x = 0, y = 0;
+    float directionX = 0, directionY = 0;
+    int postedKey[4] = {-1, -1, -1, -1};
+
+    // Chunks holding private changes (open doors, repaired cells). Evicting
+    // them would bring back the file's contents, so they stay.
+    std::vector<uint8_t> pinned;
+    int loads = 0;
+    int evictions = 0;
+
+    // Only touched by the streaming thread.
+    std::vector<uint32_t> lastWanted; // update that last wanted each chunk, 0 if not resident
+    std::vector<int> resident;
+    uint32_t tick = 0;
+    std::chrono::steady_clock::time_point lastSweep;
+};
+
+inline size_t streamPageSize()
+{
+#ifdef _WIN32
+    return 4096;
+#else
+    return sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Sets up streaming for a mapped world; the thread is started separately.
+inline void initChunkStreamer(ChunkStreamer *streamer, uint8_t *const *layers, int layerCount, size_t chunkBytes, int chunksX, int chunksY)
+{
+    for (int layer = 0; layer < layerCount; layer++)
+    {
+        streamer->layers[layer] = layers[layer];
+    }
+    streamer->layerCount = layerCount;
+    streamer->chunkBytes = chunkBytes;
+    streamer->chunksX = chunksX;
+    streamer->chunksY = chunksY;
+    streamer->pinned.assign((size_t)chunksX * chunksY, 0);
+    streamer->lastWanted.assign((size_t)chunksX * chunksY, 0);
+    streamer->resident.clear();
+    streamer->tick = 0;
+}
+
+inline void pinChunk(ChunkStreamer *streamer, int chunk)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    streamer->pinned[chunk] = 1;
+}
+
+// Reads one byte of every page so the chunk is mapped before a ray needs it.
+inline void loadChunk(ChunkStreamer *streamer, int chunk)
+{
+    size_t page = streamPageSize();
+    for (int layer = 0; layer < streamer->layerCount; layer++)
+    {
+        uint8_t *begin = streamer->layers[layer] + chunk * streamer->chunkBytes;
+#ifndef _WIN32
+        uint8_t *pageBegin = (uint8_t *)((uintptr_t)begin & ~(uintptr_t)(page - 1));
+        madvise(pageBegin, begin + streamer->chunkBytes - pageBegin, MADV_WILLNEED);
+#endif
+        for (size_t offset = 0; offset < streamer->chunkBytes; offset += page)
+        {
+            *(volatile uint8_t *)(begin + offset);
+        }
+    }
+}
+
+// Hands the page aligned range [begin, end) back to the OS. Private changes
+// in it are lost, so callers never pass pages of a pinned chunk.
+inline void releasePages(uintptr_t begin, uintptr_t end)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+#ifdef _WIN32
+    // Unlocking pages that were never locked takes them out of the working set.
+    VirtualUnlock((void *)begin, end - begin);
+#else
+    madvise((void *)begin, end - begin, MADV_DONTNEED);
+#endif
+}
+
+// Drops the pages of [begin, end) in every layer that lie wholly inside the
+// range; pages shared with a neighbouring chunk are left alone.
+inline void releaseChunkRange(ChunkStreamer *streamer, size_t begin, size_t end)
+{
+    size_t page = streamPageSize();
+    for (int layer = 0; layer < streamer->layerCount; layer++)
+    {
+        uintptr_t first = ((uintptr_t)(streamer->layers[layer] + begin) + page - 1) & ~(uintptr_t)(page - 1);
+        uintptr_t last = (uintptr_t)(streamer->layers[layer] + end) & ~(uintptr_t)(page - 1);
+        releasePages(first, last);
+    }
+}
+
+// Page aligned part of chunks [first, last) in one layer, clipped to the
+// layer's chunks so a page shared with another layer or the header is never
+// dropped.
+inline void chunkPages(const ChunkStreamer *streamer, int layer, int first, int last, uintptr_t *begin, uintptr_t *end)
+{
+    uintptr_t page = streamPageSize();
+    uintptr_t base = (uintptr_t)streamer->layers[layer];
+    uintptr_t limit = base + (uintptr_t)streamer->chunksX * streamer->chunksY * streamer->chunkBytes;
+    *begin = std::max((base + first * streamer->chunkBytes) & ~(page - 1), (base + page - 1) & ~(page - 1));
+    *end = std::min((base + last * streamer->chunkBytes + page - 1) & ~(page - 1), limit & ~(page - 1));
+}
+
+// Evicts a chunk together with every chunk sharing one of its pages, which
+// only happens with pages bigger than a chunk (16 KB pages hold four). Nothing
+// is dropped if any of them is pinned or wanted right now. Holding the lock
+// keeps a chunk from being pinned and written while its pages go. Returns the
+// number of tracked chunks that were evicted.
+inline int evictChunk(ChunkStreamer *streamer, int chunk)
+{
+    int first = chunk, last = chunk + 1;
+    bool releasable = false;
+    for (int layer = 0; layer < streamer->layerCount; layer++)
+    {
+        uintptr_t begin, end;
+        chunkPages(streamer, layer, chunk, chunk + 1, &begin, &end);
+        uintptr_t base = (uintptr_t)streamer->layers[layer];
+        if (begin < end)
+        {
+            first = std::min(first, (int)((begin - base) / streamer->chunkBytes));
+            last = std::max(last, (int)((end - base + streamer->chunkBytes - 1) / streamer->chunkBytes));
+            releasable = true;
+        }
+    }
+    if (!releasable)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    for (int other = first; other < last; other++)
+    {
+        if (streamer->pinned[other] || streamer->lastWanted[other] == streamer->tick)
+        {
+            return 0;
+        }
+    }
+    for (int layer = 0; layer < streamer->layerCount; layer++)
+    {
+        uintptr_t begin, end;
+        chunkPages(streamer, layer, chunk, chunk + 1, &begin, &end);
+        releasePages(begin, end);
+    }
+    int evicted = 0;
+    for (int other = first; other < last; other++)
+    {
+        evicted += streamer->lastWanted[other] != 0;
+        streamer->lastWanted[other] = 0;
+    }
+    streamer->evictions += evicted;
+    return evicted;
+}
+
+// Hands back the pages of every chunk that is neither tracked nor pinned, in
+// runs. Pages shared with a tracked or pinned chunk are kept.
+inline void releaseUntracked(ChunkStreamer *streamer)
+{
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    int chunkCount = streamer->chunksX * streamer->chunksY;
+    int runStart = 0;
+    for (int chunk = 0; chunk <= chunkCount; chunk++)
+    {
+        if (chunk == chunkCount || streamer->pinned[chunk] || streamer->lastWanted[chunk] != 0)
+        {
+            if (runStart < chunk)
+            {
+                releaseChunkRange(streamer, runStart * streamer->chunkBytes, chunk * streamer->chunkBytes);
+            }
+            runStart = chunk + 1;
+        }
+    }
+    streamer->lastSweep = std::chrono::steady_clock::now();
+}
+
+inline void wantChunk(ChunkStreamer *streamer, int chunkX, int chunkY)
+{
+    if (chunkX < 0 || chunkX >= streamer->chunksX || chunkY < 0 || chunkY >= streamer->chunksY)
+    {
+        return;
+    }
+    int chunk = chunkY * streamer->chunksX + chunkX;
+    if (streamer->lastWanted[chunk] == streamer->tick)
+    {
+        return;
+    }
+    if (streamer->lastWanted[chunk] == 0)
+    {
+        loadChunk(streamer, chunk);
+        streamer->resident.push_back(chunk);
+        std::lock_guard<std::mutex> lock(streamer->mutex);
+        streamer->loads++;
+    }
+    streamer->lastWanted[chunk] = streamer->tick;
+}
+
+inline void updateChunks(ChunkStreamer *streamer, float x, float y, float directionX, float directionY)
+{
+    streamer->tick++;
+    int centerX = std::floor(x);
+    int centerY = std::floor(y);
+    for (int ring = 0; ring <= streamer->radius; ring++)
+    {
+        for (int dy = -ring; dy <= ring; dy++)
+        {
+            for (int dx = -ring; dx <= ring; dx++)
+            {
+                if (std::max(std::abs(dx), std::abs(dy)) == ring)
+                {
+                    wantChunk(streamer, centerX + dx, centerY + dy);
+                }
+            }
+        }
+    }
+    for (int step = 1; step <= streamer->lookahead; step++)
+    {
+        int aheadX = std::floor(x + directionX * (streamer->radius + step));
+        int aheadY = std::floor(y + directionY * (streamer->radius + step));
+        for (int dy = -1; dy <= 1; dy++)
+        {
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                wantChunk(streamer, aheadX + dx, aheadY + dy);
+            }
+        }
+    }
+
+    if ((int)streamer->resident.size() <= streamer->budget)
+    {
+        return;
+    }
+    std::vector<int> &resident = streamer->resident;
+    std::sort(resident.begin(), resident.end(), [&](int a, int b)
+              { return streamer->lastWanted[a] < streamer->lastWanted[b]; });
+    int excess = resident.size() - streamer->budget;
+    for (int i = 0; i < (int)resident.size() && excess > 0; i++)
+    {
+        // A neighbour evicted earlier in this loop already reads 0.
+        if (streamer->lastWanted[resident[i]] != 0)
+        {
+            excess -= evictChunk(streamer, resident[i]);
+        }
+    }
+    resident.erase(std::remove_if(resident.begin(), resident.end(), [&](int chunk)
+                                  { return streamer->lastWanted[chunk] == 0; }),
+                   resident.end());
+}
+
+inline void streamLoop(ChunkStreamer *streamer)
+{
+    std::unique_lock<std::mutex> lock(streamer->mutex);
+    while (true)
+    {
+        streamer->wake.wait_until(lock, streamer->lastSweep + std::chrono::milliseconds(streamer->sweepMs), [&]
+                                  { return streamer->stopping || streamer->moved; });
+        if (streamer->stopping)
+        {
+            return;
+        }
+        bool moved = streamer->moved;
+        streamer->moved = false;
+        float x = streamer->x, y = streamer->y;
+        float directionX = streamer->directionX, directionY = streamer->directionY;
+
+        lock.unlock();
+        if (moved)
+        {
+            updateChunks(streamer, x, y, directionX, directionY);
+        }
+        if (std::chrono::steady_clock::now() - streamer->lastSweep >= std::chrono::milliseconds(streamer->sweepMs))
+        {
+            releaseUntracked(streamer);
+        }
+        lock.lock();
+    }
+}
+
+// Hands everything not pinned back to the OS, so a map that was read in full
+// while loading starts from an empty cache, then starts the streaming thread.
+inline void startChunkStreamer(ChunkStreamer *streamer)
+{
+#ifndef _WIN32
+    // Chunks are prefetched explicitly from here on, so a read outside them
+    // only needs its own page, not a whole readahead window. Loading scans the
+    // layers once front to back and keeps the default readahead for that.
+    size_t page = streamPageSize();
+    for (int layer = 0; layer < streamer->layerCount; layer++)
+    {
+        uintptr_t first = (uintptr_t)streamer->layers[layer] & ~(uintptr_t)(page - 1);
+        madvise((void *)first, (uintptr_t)(streamer->layers[layer] + streamer->chunkBytes * streamer->chunksX * streamer->chunksY) - first, MADV_RANDOM);
+    }
+#endif
+    releaseUntracked(streamer);
+    streamer->stopping = false;
+    streamer->running = true;
+    streamer->thread = std::thread(streamLoop, streamer);
+}
+
+inline void stopChunkStreamer(ChunkStreamer *streamer)
+{
+    if (!streamer->running)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(streamer->mutex);
+        streamer->stopping = true;
+    }
+    streamer->wake.notify_one();
+    streamer->thread.join();
+    streamer->running = false;
+}
+
+// Called by the game with the player's position and movement in chunks. Only
+// wakes the streaming thread when the chunk the player is in, or the one the
+// lookahead reaches, has changed.
+inline void postChunkPosition(ChunkStreamer *streamer, float x, float y, float moveX, float moveY)
+{
+    float length = std::sqrt(moveX * moveX + moveY * moveY);
+    float directionX = length > 0 ? moveX / length : 0;
+    float directionY = length > 0 ? moveY / length : 0;
+    int reach = streamer->radius + streamer->lookahead;
+    int key[4] = {(int)std::floor(x), (int)std::floor(y), (int)std::floor(x + directionX * reach), (int)std::floor(y + directionY * reach)};
+
+    std::lock_guard<std::mutex> lock(streamer->mutex);
+    if (std::equal(key, key + 4, streamer->postedKey))
+    {
+        return;
+    }
+    std::copy(key, key + 4, streamer->postedKey);
+    streamer->x = x;
+    streamer->y = y;
+    streamer->directionX = directionX;
+    streamer->directionY = directionY;
+    streamer->moved = true;
+    streamer->wake.notify_one();
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include <cstdint>
+#ifdef RAYCASTER_DEBUG
+#include <iostream>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RAYCASTER_AVX2
+#endif
+
+// Layout of a map layer with its one cell border. Cells are stored in square
+// tiles of 1 << tileShift cells, tiles in row order, so a tileShift of 0 is
+// plain row-major and 3 keeps each 8x8 block in one cache line.
+struct MapLayout
+{
+    int tileShift;
+    int tilesPerRow;
+};
+
+// x and y are map coordinates, -1 being the border.
+inline int mapLayoutIndex(const MapLayout &layout, int x, int y)
+{
+    x += 1;
+    y += 1;
+    int mask = (1 << layout.tileShift) - 1;
+    int tile = (y >> layout.tileShift) * layout.tilesPerRow + (x >> layout.tileShift);
+    return (tile << (2 * layout.tileShift)) + ((y & mask) << layout.tileShift) + (x & mask);
+}
+
+#ifdef RAYCASTER_AVX2
+__attribute__((target("avx2"))) inline __m256i mapLayoutIndex8(const MapLayout &layout, __m256i x, __m256i y)
+{
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i mask = _mm256_set1_epi32((1 << layout.tileShift) - 1);
+    __m128i shift = _mm_cvtsi32_si128(layout.tileShift);
+    x = _mm256_add_epi32(x, one);
+    y = _mm256_add_epi32(y, one);
+    __m256i tile = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srl_epi32(y, shift), _mm256_set1_epi32(layout.tilesPerRow)), _mm256_srl_epi32(x, shift));
+    __m256i inTile = _mm256_add_epi32(_mm256_sll_epi32(_mm256_and_si256(y, mask), shift), _mm256_and_si256(x, mask));
+    return _mm256_add_epi32(_mm256_sll_epi32(tile, _mm_cvtsi32_si128(2 * layout.tileShift)), inTile);
+}
+#endif
+
+// Everything needed to shade one floor row and its mirrored ceiling row. A
+// column's floor point is origin + tangents[column] * step. Texture tables are
+// indexed by texture id and already resolved to the row's mip level.
+struct FloorRowParams
+{
+    float originX, originY;
+    float stepX, stepY;
+    int y;
+    int level;
+    int columnCount;
+    const float *tangents;
+    const float *wallBottoms;
+    const uint8_t *floors; // one byte per cell, addressed through layout
+    const uint8_t *ceilings;
+    MapLayout layout;
+    int mapX, mapY;
+    const uint32_t *atlas;
+    const int *levelOffsets;
+    const int *levelShifts;
+    const int *levelHeights; // 0 where the texture has no such level
+    int textureCount;
+    uint32_t *floorColors;   // 0 where nothing should be drawn
+    uint32_t *ceilingColors; // 0 where nothing should be drawn
+};
+
+typedef void (*FloorRowKernel)(const FloorRowParams &row);
+
+inline uint32_t shadeFloorTexel(const FloorRowParams &row, int textureId, int texelX, int texelY)
+{
+    if (textureId == 0)
+    {
+        return 0;
+    }
+#ifdef RAYCASTER_DEBUG
+    // Ids are checked once at load, so only debug builds check every fetch.
+    if (textureId < 1 || textureId > row.textureCount)
+    {
+        std::cerr << "Invalid texture id: " << textureId << std::endl;
+        return 0xffff00ff;
+    }
+    if (row.levelHeights[textureId] == 0)
+    {
+        std::cerr << "Invalid mip level: " << row.level << std::endl;
+        return 0xffff00ff;
+    }
+    if (texelX < 0 || texelX >= (1 << row.levelShifts[textureId]) || texelY < 0 || texelY >= row.levelHeights[textureId])
+    {
+        std::cerr << "Coordinates out of bounds: " << texelX << ", " << texelY << std::endl;
+        return 0xffff00ff;
+    }
+#endif
+    return row.atlas[row.levelOffsets[textureId] + (texelY << row.levelShifts[textureId]) + texelX] | 0xff000000;
+}
+
+inline void shadeFloorColumns(const FloorRowParams &row, int begin, int end)
+{
+    for (int column = begin; column < end; column++)
+    {
+        row.floorColors[column] = 0;
+        row.ceilingColors[column] = 0;
+
+        // Same as y >= (int)wallBottoms[column] without the cast overflowing
+        // for walls far taller than the screen.
+        if (!(row.y + 1.0f > row.wallBottoms[column]))
+        {
+            continue;
+        }
+
+        float textureX = row.originX + row.tangents[column] * row.stepX;
+        float textureY = row.originY + row.tangents[column] * row.stepY;
+        int cellX = (int)(textureX / 32.0f);
+        int cellY = (int)(textureY / 32.0f);
+        if (cellX < 0 || cellX >= row.mapX || cellY < 0 || cellY >= row.mapY)
+        {
+            continue;
+        }
+
+        int cell = mapLayoutIndex(row.layout, cellX, cellY);
+        int texelX = ((int)textureX & 31) >> row.level;
+        int texelY = ((int)textureY & 31) >> row.level;
+        row.floorColors[column] = shadeFloorTexel(row, row.floors[cell], texelX, texelY);
+        row.ceilingColors[column] = shadeFloorTexel(row, row.ceilings[cell], texelX, texelY);
+    }
+}
+
+inline void shadeFloorRowScalar(const FloorRowParams &row)
+{
+    shadeFloorColumns(row, 0, row.columnCount);
+}
+
+#ifdef RAYCASTER_AVX2
+__attribute__((target("avx2"))) inline __m256i shadeFloorTexels8(const FloorRowParams &row, __m256i textureIds, __m256i texelX, __m256i texelY, __m256i mask)
+{
+    __m256i zero = _mm256_setzero_si256();
+    mask = _mm256_andnot_si256(_mm256_cmpeq_epi32(textureIds, zero), mask);
+    __m256i offsets = _mm256_mask_i32gather_epi32(zero, row.levelOffsets, textureIds, mask, 4);
+    __m256i shifts = _mm256_mask_i32gather_epi32(zero, row.levelShifts, textureIds, mask, 4);
+    __m256i index = _mm256_add_epi32(_mm256_add_epi32(offsets, _mm256_sllv_epi32(texelY, shifts)), texelX);
+    __m256i texels = _mm256_mask_i32gather_epi32(zero, (const int *)row.atlas, index, mask, 4);
+    return _mm256_and_si256(_mm256_or_si256(texels, _mm256_set1_epi32(0xff000000)), mask);
+}
+
+// Eight columns per iteration, producing the same colors as shadeFloorColumns():
+// dividing by 32 is exact in float and no multiply-add is fused.
+__attribute__((target("avx2"))) inline void shadeFloorRowAVX2(const FloorRowParams &row)
+{
+    __m256 originX = _mm256_set1_ps(row.originX);
+    __m256 originY = _mm256_set1_ps(row.originY);
+    __m256 stepX = _mm256_set1_ps(row.stepX);
+    __m256 stepY = _mm256_set1_ps(row.stepY);
+    __m256 rowBottom = _mm256_set1_ps(row.y + 1.0f);
+    __m256 cellScale = _mm256_set1_ps(1 / 32.0f);
+    __m256i mapX = _mm256_set1_epi32(row.mapX);
+    __m256i byteMask = _mm256_set1_epi32(0xff);
+    __m256i mapY = _mm256_set1_epi32(row.mapY);
+    __m256i minusOne = _mm256_set1_epi32(-1);
+    __m256i texelMask = _mm256_set1_epi32(31);
+    __m128i level = _mm_cvtsi32_si128(row.level);
+    __m256i zero = _mm256_setzero_si256();
+
+    int column = 0;
+    for (; column + 8 <= row.columnCount; column += 8)
+    {
+        __m256 tangents = _mm256_loadu_ps(row.tangents + column);
+        __m256 textureX = _mm256_add_ps(originX, _mm256_mul_ps(tangents, stepX));
+        __m256 textureY = _mm256_add_ps(originY, _mm256_mul_ps(tangents, stepY));
+        __m256i cellX = _mm256_cvttps_epi32(_mm256_mul_ps(textureX, cellScale));
+        __m256i cellY = _mm256_cvttps_epi32(_mm256_mul_ps(textureY, cellScale));
+
+        __m256i mask = _mm256_castps_si256(_mm256_cmp_ps(rowBottom, _mm256_loadu_ps(row.wallBottoms + column), _CMP_GT_OQ));
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(cellX, minusOne));
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(mapX, cellX));
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(cellY, minusOne));
+        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(mapY, cellY));
+        if (_mm256_testz_si256(mask, mask))
+        {
+            _mm256_storeu_si256((__m256i *)(row.floorColors + column), zero);
+            _mm256_storeu_si256((__m256i *)(row.ceilingColors + column), zero);
+            continue;
+        }
+
+        __m256i cell = mapLayoutIndex8(row.layout, cellX, cellY);
+        __m256i texelX = _mm256_srl_epi32(_mm256_and_si256(_mm256_cvttps_epi32(textureX), texelMask), level);
+        __m256i texelY = _mm256_srl_epi32(_mm256_and_si256(_mm256_cvttps_epi32(textureY), texelMask), level);
+
+        // The layers are bytes with slack at the end; keep the low byte of each 32 bit read.
+        __m256i floorIds = _mm256_and_si256(_mm256_mask_i32gather_epi32(zero, (const int *)row.floors, cell, mask, 1), byteMask);
+        __m256i ceilingIds = _mm256_and_si256(_mm256_mask_i32gather_epi32(zero, (const int *)row.ceilings, cell, mask, 1), byteMask);
+        _mm256_storeu_si256((__m256i *)(row.floorColors + column), shadeFloorTexels8(row, floorIds, texelX, texelY, mask));
+        _mm256_storeu_si256((__m256i *)(row.ceilingColors + column), shadeFloorTexels8(row, ceilingIds, texelX, texelY, mask));
+    }
+    shadeFloorColumns(row, column, row.columnCount);
+}
+#endif
+
+inline bool cpuSupportsAVX2()
+{
+#ifdef RAYCASTER_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+// Picks the widest kernel the CPU supports, or the scalar one if allowSimd is false.
+inline FloorRowKernel selectFloorRowKernel(bool allowSimd, const char **name)
+{
+#ifdef RAYCASTER_AVX2
+    if (allowSimd && cpuSupportsAVX2())
+    {
+        *name = "avx2";
+        return shadeFloorRowAVX2;
+    }
+#endif
+    *name = "scalar";
+    return shadeFloorRowScalar;
+}
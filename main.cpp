@@ -9,8 +9,18 @@
 #include <algorithm>
 #include <cmath>
 #include "textures.h"
+#include "threadpool.h"
+#include "profiler.h"
+#include "floorkernel.h"
+#include "mapfile.h"
+#include "chunkstream.h"
+#ifdef RAYCASTER_TEXTURE_PACK
+#include "texturepack.h"
+#endif
 #include <vector>
 #include <fstream>
+#include <cstring>
+#include <cstdio>
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
@@ -40,14 +50,35 @@ struct Sprite
     float scaleX = 1;
     float scaleY = 1;
     bool active;
+    float prevX = 0, prevY = 0; // position before the last simulation step
 };
 
 float deltaTime;
 
+// Simulation always advances in fixed steps; rendering blends the last two
+// simulation states by renderAlpha.
+const float fixedTimestep = 1.0f / 60.0f;
+float renderAlpha = 1;
+
 const int spriteCount = 4;
 Sprite sprites[spriteCount];
 
-const float rayStep = 0.25;
+// Internal render resolution and projection. Everything in the renderer is
+// derived from these, with 1024x512 as the reference size the wall and sprite
+// scales were tuned at.
+struct RenderConfig
+{
+    int width = 1024;
+    int height = 512;
+    int windowWidth = 0; // 0 means same as the render size
+    int windowHeight = 0;
+    float columnsPerPixel = 240.0f / 1024.0f;
+    float FOV = 60;
+    bool simd = true;
+    bool rayPackets = false; // asked for with --ray-packets, cleared at startup without AVX2
+};
+
+RenderConfig renderConfig;
 
 std::vector<std::string> textureFilepaths = {
     "./textures/texture-1.png",
@@ -59,475 +90,1613 @@ std::vector<std::string> textureFilepaths = {
     "./textures/Enemy-Placeholder.png",
     "./textures/bomb.png"};
 
+// Packed ARGB8888 image used while building the atlas.
+struct TextureImage
+{
+    int width, height;
+    std::vector<uint32_t> texels;
+};
+
+// One mip level inside textureAtlas, stored twice: row major for the floor
+// sampler and transposed so wall slices and sprites, which walk one texture
+// column top to bottom, read sequentially. Rows and columns are padded to a
+// power of two so addressing is a shift and an add.
+struct TextureLevel
+{
+    int width, height;
+    int widthShift, heightShift;
+    int texelOffset;  // texel (x, y) is at texelOffset + (y << widthShift) + x
+    int columnOffset; // texel (x, y) is at columnOffset + (x << heightShift) + y
+};
+
+// width and height are the size of level 0; each following level halves both
+// down to 1x1.
 struct Texture
 {
-    int width, height, channels;
-    unsigned char *data;
+    int width, height;
+    std::vector<TextureLevel> levels;
 };
 
-std::vector<Texture> loadedTextures;
+// Every level of every texture lives in this single allocation.
+std::vector<uint32_t> textureAtlas;
 
-void loadTextures()
+int ceilLog2(int value)
 {
-    for (const auto &filepath : textureFilepaths)
+    int shift = 0;
+    while ((1 << shift) < value)
     {
-        Texture tex;
-        tex.data = stbi_load(filepath.c_str(), &tex.width, &tex.height, &tex.channels, 4);
-        if (!tex.data)
-        {
-            std::cerr << "Failed to load texture: " << filepath << std::endl;
-            continue;
-        }
-        loadedTextures.push_back(tex);
+        shift++;
     }
+    return shift;
 }
 
-float distances[241];
-
-int mapX;
-int mapY;
-int cellWidth = 64;
-int maxDepth;
-
-std::vector<int> map;
-std::vector<int> mapFloors;
-std::vector<int> mapCeiling;
-
-int bombCount = 0;
-
-void deserialize(const std::string &filename)
+TextureLevel addAtlasLevel(const TextureImage &image)
 {
-    std::ifstream file(filename, std::ios::binary | std::ios::in);
-    if (file)
+    TextureLevel level;
+    level.width = image.width;
+    level.height = image.height;
+    level.widthShift = ceilLog2(image.width);
+    level.heightShift = ceilLog2(image.height);
+
+    level.texelOffset = textureAtlas.size();
+    textureAtlas.resize(textureAtlas.size() + (image.height << level.widthShift), 0);
+    level.columnOffset = textureAtlas.size();
+    textureAtlas.resize(textureAtlas.size() + (image.width << level.heightShift), 0);
+
+    for (int y = 0; y < image.height; y++)
     {
-        file.read(reinterpret_cast<char *>(&mapX), sizeof(int));
-        file.read(reinterpret_cast<char *>(&mapY), sizeof(int));
-        maxDepth = std::max(mapX, mapY);
+        for (int x = 0; x < image.width; x++)
+        {
+            uint32_t texel = image.texels[y * image.width + x];
+            textureAtlas[level.texelOffset + (y << level.widthShift) + x] = texel;
+            textureAtlas[level.columnOffset + (x << level.heightShift) + y] = texel;
+        }
+    }
+    return level;
+}
 
-        size_t count;
-        file.read(reinterpret_cast<char *>(&count), sizeof(count));
-        std::cout << "Deserializing map with count: " << count << "\n";
-        map.resize(count);
-        file.read(reinterpret_cast<char *>(map.data()), sizeof(int) * count);
+// Box filters 2x2 blocks. Color is averaged over the opaque texels only and
+// alpha stays either 0 or 255, so sprite edges neither bleed black nor fade out.
+TextureImage downsampleImage(const TextureImage &source)
+{
+    TextureImage image;
+    image.width = std::max(1, source.width / 2);
+    image.height = std::max(1, source.height / 2);
+    image.texels.resize(image.width * image.height);
 
-        count;
-        file.read(reinterpret_cast<char *>(&count), sizeof(count));
-        std::cout << "Deserializing mapFloors with count: " << count << "\n";
-        mapFloors.resize(count);
-        file.read(reinterpret_cast<char *>(mapFloors.data()), sizeof(int) * count);
+    for (int y = 0; y < image.height; y++)
+    {
+        for (int x = 0; x < image.width; x++)
+        {
+            int r = 0, g = 0, b = 0, opaque = 0, samples = 0;
+            for (int sy = y * 2; sy < std::min(y * 2 + 2, source.height); sy++)
+            {
+                for (int sx = x * 2; sx < std::min(x * 2 + 2, source.width); sx++)
+                {
+                    uint32_t texel = source.texels[sy * source.width + sx];
+                    samples++;
+                    if ((texel >> 24) != 0)
+                    {
+                        r += (texel >> 16) & 0xff;
+                        g += (texel >> 8) & 0xff;
+                        b += texel & 0xff;
+                        opaque++;
+                    }
+                }
+            }
 
-        count;
-        file.read(reinterpret_cast<char *>(&count), sizeof(count));
-        std::cout << "Deserializing mapCeiling with count: " << count << "\n";
-        mapCeiling.resize(count);
-        file.read(reinterpret_cast<char *>(mapCeiling.data()), sizeof(int) * count);
-        file.close();
+            uint32_t texel = 0;
+            if (opaque * 2 >= samples)
+            {
+                texel = 0xff000000 | ((r / opaque) << 16) | ((g / opaque) << 8) | (b / opaque);
+            }
+            image.texels[y * image.width + x] = texel;
+        }
     }
-    else
+    return image;
+}
+
+Texture addAtlasTexture(TextureImage image)
+{
+    Texture tex;
+    tex.width = image.width;
+    tex.height = image.height;
+    tex.levels.push_back(addAtlasLevel(image));
+    while (image.width > 1 || image.height > 1)
     {
-        std::cerr << "Error opening file for reading.\n";
+        image = downsampleImage(image);
+        tex.levels.push_back(addAtlasLevel(image));
     }
+    return tex;
 }
 
-float FixAngle(float a)
+// Unchecked column fetch for the inner loops. Texture ids in the map are
+// checked once at load (validateMap() or validateMappedLayer()) and the
+// samplers clamp their coordinates, so only -DRAYCASTER_DEBUG builds check the
+// level and column here.
+const uint32_t *textureColumn(const Texture &tex, int level, int x)
 {
-    if (a > 359)
+#ifdef RAYCASTER_DEBUG
+    if (level < 0 || level >= (int)tex.levels.size())
     {
-        a -= 360;
+        std::cerr << "Invalid mip level: " << level << std::endl;
+        level = 0;
     }
-    if (a < 0)
+    if (x < 0 || x >= tex.levels[level].width)
     {
-        a += 360;
+        std::cerr << "Coordinates out of bounds: " << x << std::endl;
+        x = 0;
     }
-    return a;
+#endif
+    const TextureLevel &mip = tex.levels[level];
+    return &textureAtlas[mip.columnOffset + (x << mip.heightShift)];
 }
 
-void getRGBFromTexture(int hitType, int x, int y, uint8_t &r, uint8_t &g, uint8_t &b)
+// footprint is how many level 0 texels land on one screen pixel. Picks the level
+// where that is closest to one, so distant surfaces read a small mip that stays
+// in cache instead of skipping through the full image.
+int mipLevel(const Texture &tex, float footprint)
 {
-    if (hitType < 1 || hitType > loadedTextures.size())
+    if (!(footprint >= 2))
     {
-        std::cerr << "Invalid hitType: " << hitType << std::endl;
-        return;
+        return 0;
     }
+    return std::min((int)tex.levels.size() - 1, std::ilogb(footprint));
+}
+
+std::vector<Texture> loadedTextures;
 
-    const Texture &tex = loadedTextures[hitType - 1];
-    if (x < 0 || x >= tex.width || y < 0 || y >= tex.height)
+bool loadTextureImage(const std::string &filepath, TextureImage *image)
+{
+    int channels;
+    unsigned char *data = stbi_load(filepath.c_str(), &image->width, &image->height, &channels, 4);
+    if (!data)
     {
-        std::cerr << "Coordinates out of bounds: " << x << ", " << y << std::endl;
-        return;
+        return false;
     }
 
-    int index = (y * tex.width + x) * 4;
-    r = tex.data[index];
-    g = tex.data[index + 1];
-    b = tex.data[index + 2];
+    image->texels.resize(image->width * image->height);
+    for (int i = 0; i < image->width * image->height; i++)
+    {
+        const unsigned char *texel = &data[i * 4];
+        image->texels[i] = (texel[3] << 24) | (texel[0] << 16) | (texel[1] << 8) | texel[2];
+    }
+    stbi_image_free(data);
+    return true;
 }
 
-void getRGBFromTexture(int hitType, int x, int y, uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &a)
+// The first six tables in textures.h are 32x32 copies of texture-1..6.png in
+// RGBA byte order, used when the PNG is missing so texture ids never shift.
+bool embeddedTextureImage(int index, TextureImage *image)
 {
-    if (hitType < 1 || hitType > loadedTextures.size())
+    if (index >= 6)
     {
-        std::cerr << "Invalid hitType: " << hitType << std::endl;
-        return;
+        return false;
     }
 
-    const Texture &tex = loadedTextures[hitType - 1];
-    if (x < 0 || x >= tex.width || y < 0 || y >= tex.height)
+    image->width = 32;
+    image->height = 32;
+    image->texels.resize(32 * 32);
+    for (int i = 0; i < 32 * 32; i++)
     {
-        std::cerr << "Coordinates out of bounds: " << x << ", " << y << std::endl;
-        return;
+        uint32_t rgba = textures[index][i];
+        image->texels[i] = (rgba & 0xff00ff00) | ((rgba & 0xff) << 16) | ((rgba >> 16) & 0xff);
     }
-
-    int index = (y * tex.width + x) * 4;
-    r = tex.data[index];
-    g = tex.data[index + 1];
-    b = tex.data[index + 2];
-    a = tex.data[index + 3];
+    return true;
 }
 
-float degToRad(float angle) { return angle * M_PI / 180.0; }
-
-int getCell(int x, int y)
+#ifdef RAYCASTER_TEXTURE_PACK
+// texturepack.h is generated by packtextures.cpp, in the same order as
+// textureFilepaths, and is already in the atlas pixel format.
+bool packedTextureImage(int index, TextureImage *image)
 {
-    if (x >= 0 && x < mapX && y >= 0 && y < mapY)
+    if (index >= packedTextureCount)
     {
-        int cellIndex = y * mapX + x;
-        return cellIndex;
-    }
-    else
-    {
-        return -1;
+        return false;
     }
+
+    const PackedTexture &packed = packedTextures[index];
+    image->width = packed.width;
+    image->height = packed.height;
+    image->texels.assign(packed.texels, packed.texels + packed.width * packed.height);
+    return true;
 }
+#endif
 
-void drawMap(SDL_Renderer *renderer)
+void loadTextures()
 {
-    for (int y = 0; y < mapY; y++)
+    textureAtlas.clear();
+    loadedTextures.clear();
+    for (int i = 0; i < (int)textureFilepaths.size(); i++)
     {
-        for (int x = 0; x < mapX; x++)
+        TextureImage image;
+#ifdef RAYCASTER_TEXTURE_PACK
+        if (packedTextureImage(i, &image))
         {
-            int cell = getCell(x, y);
-
-            if (map[cell] == 1)
-            {
-                SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            }
-            else
+            loadedTextures.push_back(addAtlasTexture(image));
+            continue;
+        }
+#endif
+        if (!loadTextureImage(textureFilepaths[i], &image))
+        {
+            if (!embeddedTextureImage(i, &image))
             {
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                std::cerr << "Failed to load texture: " << textureFilepaths[i] << std::endl;
+                continue;
             }
-
-            SDL_Rect rect;
-            rect.x = x * cellWidth;
-            rect.y = y * cellWidth;
-            rect.w = cellWidth;
-            rect.h = cellWidth;
-
-            SDL_RenderFillRect(renderer, &rect);
+            std::cerr << "Failed to load texture: " << textureFilepaths[i] << ", using the built in copy" << std::endl;
         }
+        loadedTextures.push_back(addAtlasTexture(image));
     }
+    textureAtlas.shrink_to_fit();
 }
 
-void raycast(Player *player, SDL_Renderer *renderer)
-{
-    float rayAngle = FixAngle(player->angle - (player->FOV / 2));
+Profiler profiler;
 
-    for (float i = 0; i < player->FOV; i += rayStep)
-    {
-        float rayX = player->pos.x;
-        float rayY = player->pos.y;
-        float dy;
-        float dx;
+// Per column depth buffer, sized by buildColumnTable().
+std::vector<float> distances;
+std::vector<float> wallBottoms;
 
-        float distanceHorizontal = 10000000;
-        int cellIndexX;
-        int cellIndexY = floor(rayY / cellWidth);
-        int depth = 0;
+int mapX;
+int mapY;
+int cellWidth = 64;
 
-        int mappedPosHorizontal;
-        int hitTypeHorizontal;
+// Layers as stored in map.dat, one int per cell. Only used while loading;
+// buildMapGrid() packs them into mapGrid and releases them.
+std::vector<int> map;
+std::vector<int> mapFloors;
+std::vector<int> mapCeiling;
 
-        while (depth < maxDepth)
-        {
+// Border cells in mapGrid.walls. Rays stop on them without a hit, the same as
+// walking off the map, and nothing can move into them.
+const uint8_t mapOutside = 0xff;
 
-            if (sin(degToRad(rayAngle)) > 0)
-            {
-                dy = cellWidth - (rayY - (cellWidth * cellIndexY));
-                if (dy == 0)
-                {
-                    dy = cellWidth;
-                }
-            }
-            else
-            {
-                dy = -(rayY - (cellWidth * cellIndexY));
-                if (dy == 0)
-                {
-                    dy = -cellWidth;
-                }
-            }
-            dx = dy / tan(degToRad(rayAngle));
+// How traverseRay() gets across empty space: one cell at a time, by jumping
+// over empty 8x8 and 64x64 blocks, or by leaping as far as the distance field
+// says is clear. TraversalAuto picks blocks for maps bigger than one coarse
+// block and DDA otherwise.
+enum TraversalMode
+{
+    TraversalAuto,
+    TraversalDDA,
+    TraversalBlocks,
+    TraversalDistanceField
+};
 
-            rayY = rayY + dy;
-            rayX = rayX + dx;
-            cellIndexX = floor(rayX / cellWidth);
-            cellIndexY = floor(rayY / cellWidth);
+// The three layers packed to one byte per cell, each a separate array so the
+// ray walk only touches walls. Every layer has a one cell border, so any cell
+// next to a map cell can be read without a bounds check. The arrays carry three
+// bytes of slack at the end for 32 bit gathers. Large maps can be stored in
+// tiles (see MapLayout) so rays running along y stay in cache.
+struct MapGrid
+{
+    MapLayout layout = {0, 0};
+    int layerSize = 0;
+    uint8_t *walls = nullptr;
+    uint8_t *floors = nullptr;
+    uint8_t *ceilings = nullptr;
+
+    // What the layers point into: storage when built from a legacy map.dat,
+    // the mapped file itself when loaded from a map file.
+    std::vector<uint8_t> storage;
+    MappedFile file;
+
+    TraversalMode traversal = TraversalDDA;
+
+    // Number of non-empty wall cells, border included, in each 8x8 and 64x64
+    // block of the bordered grid. Rays jump straight across blocks with none.
+    // Only built for TraversalBlocks.
+    int fineBlocksPerRow = 0;
+    int coarseBlocksPerRow = 0;
+    std::vector<uint8_t> fineBlocks;
+    std::vector<uint16_t> coarseBlocks;
+
+    // Chebyshev distance from each cell to the nearest wall or border cell, up
+    // to wallDistanceCap, in the same layout as walls. Only built for
+    // TraversalDistanceField.
+    std::vector<uint8_t> wallDistance;
+};
 
-            int mapCellIndex = getCell(cellIndexX, cellIndexY);
+const int wallDistanceCap = 32;
 
-            if (mapCellIndex == -1)
-            {
-                depth = maxDepth;
-            }
-            if (map[mapCellIndex] != 0)
-            {
-                hitTypeHorizontal = map[mapCellIndex];
-                depth = maxDepth;
-                mappedPosHorizontal = static_cast<int>((rayX - cellIndexX * cellWidth) / 2.0f);
-                distanceHorizontal = sqrt(pow(rayX - player->pos.x, 2) + pow(rayY - player->pos.y, 2));
-            }
-            if (map[getCell(cellIndexX, cellIndexY - 1)] != 0)
-            {
-                hitTypeHorizontal = map[getCell(cellIndexX, cellIndexY - 1)];
-                depth = maxDepth;
-                mappedPosHorizontal = static_cast<int>((rayX - cellIndexX * cellWidth) / 2.0f);
-                distanceHorizontal = sqrt(pow(rayX - player->pos.x, 2) + pow(rayY - player->pos.y, 2));
-            }
-            depth++;
-        }
+const int fineBlockShift = 3;
+const int coarseBlockShift = 6;
 
-        float horizontalRayX = rayX;
-        float horizontalRayY = rayY;
-        // vertical
+MapGrid mapGrid;
 
-        int mappedPosVertical;
-        int hitTypeVertical;
+// Maps stored with tileShift streamChunkShift can be streamed: each 64x64 cell
+// tile is one 4 KB chunk per layer. chunksX stays 0 for any other map.
+const int streamChunkShift = 6;
+ChunkStreamer mapStreamer;
 
-        rayX = player->pos.x;
-        rayY = player->pos.y;
+int bombCount = 0;
 
-        float distanceVertical = 10000000;
+// Clears any cell that refers to a texture that failed to load or is smaller
+// than the 32x32 tile the samplers assume, so the render loops never have to
+// check. Without checkTextures only ids that cannot be stored in a map byte are
+// cleared, which is what the converter wants: it keeps every id and leaves the
+// texture checks to load time. Returns the number of cells that were cleared.
+inline bool validTextureId(int id)
+{
+    return id >= 1 && id <= (int)loadedTextures.size() && id < mapOutside && loadedTextures[id - 1].width >= 32 && loadedTextures[id - 1].height >= 32;
+}
 
-        cellIndexX = floor(rayX / cellWidth);
+int validateLayer(std::vector<int> &layer, const char *name, bool checkTextures)
+{
+    if ((int)layer.size() != mapX * mapY)
+    {
+        std::cerr << name << " has " << layer.size() << " cells, expected " << mapX * mapY << "\n";
+        layer.resize(mapX * mapY, 0);
+    }
 
-        depth = 0;
-        while (depth < maxDepth)
+    int cleared = 0;
+    for (int &cell : layer)
+    {
+        bool valid = checkTextures ? validTextureId(cell) : cell >= 1 && cell < mapOutside;
+        if (cell != 0 && !valid)
         {
+            cell = 0;
+            cleared++;
+        }
+    }
+    if (cleared > 0)
+    {
+        std::cerr << name << ": cleared " << cleared << " cells with invalid texture ids\n";
+    }
+    return cleared;
+}
 
-            if (cos(degToRad(rayAngle)) > 0)
-            {
-                dx = cellWidth - (rayX - (cellWidth * cellIndexX));
-                if (dx == 0)
-                {
-                    dx = cellWidth;
-                }
-            }
-            else
-            {
-                dx = -(rayX - (cellWidth * cellIndexX));
-                if (dx == 0)
-                {
-                    dx = -cellWidth;
-                }
-            }
-            dy = dx / (1 / tan(degToRad(rayAngle)));
+int validateMap(bool checkTextures)
+{
+    mapX = std::max(mapX, 0);
+    mapY = std::max(mapY, 0);
+    return validateLayer(map, "map", checkTextures) + validateLayer(mapFloors, "mapFloors", checkTextures) + validateLayer(mapCeiling, "mapCeiling", checkTextures);
+}
 
-            rayY = rayY + dy;
-            rayX = rayX + dx;
-            cellIndexX = floor(rayX / cellWidth);
-            cellIndexY = floor(rayY / cellWidth);
-            int mapCellIndex = getCell(cellIndexX, cellIndexY);
+// Index of cell (x, y) in the mapGrid layers; x and y may be -1 or mapX / mapY
+// to address the border.
+inline int mapIndex(int x, int y)
+{
+    return mapLayoutIndex(mapGrid.layout, x, y);
+}
 
-            if (mapCellIndex == -1)
-            {
-                depth = maxDepth;
-            }
+inline bool insideMap(int x, int y)
+{
+    return x >= 0 && x < mapX && y >= 0 && y < mapY;
+}
 
-            if (map[mapCellIndex] != 0)
-            {
-                hitTypeVertical = map[mapCellIndex];
-                depth = maxDepth;
-                mappedPosVertical = static_cast<int>((rayY - cellIndexY * cellWidth) / 2.0f);
-                distanceVertical = sqrt(pow(rayX - player->pos.x, 2) + pow(rayY - player->pos.y, 2));
-            }
-            if (map[getCell(cellIndexX - 1, cellIndexY)] != 0)
-            {
-                hitTypeVertical = map[getCell(cellIndexX - 1, cellIndexY)];
-                depth = maxDepth;
-                mappedPosVertical = static_cast<int>((rayY - cellIndexY * cellWidth) / 2.0f);
-                distanceVertical = sqrt(pow(rayX - player->pos.x, 2) + pow(rayY - player->pos.y, 2));
-            }
-            depth++;
+// Checked accessors for game code, which may ask about any cell.
+inline uint8_t mapWall(int x, int y)
+{
+    return insideMap(x, y) ? mapGrid.walls[mapIndex(x, y)] : mapOutside;
+}
+
+inline int fineBlockIndex(int x, int y)
+{
+    return ((y + 1) >> fineBlockShift) * mapGrid.fineBlocksPerRow + ((x + 1) >> fineBlockShift);
+}
+
+inline int coarseBlockIndex(int x, int y)
+{
+    return ((y + 1) >> coarseBlockShift) * mapGrid.coarseBlocksPerRow + ((x + 1) >> coarseBlockShift);
+}
+
+void countMapWall(int x, int y, int change)
+{
+    if (!mapGrid.fineBlocks.empty())
+    {
+        mapGrid.fineBlocks[fineBlockIndex(x, y)] += change;
+        mapGrid.coarseBlocks[coarseBlockIndex(x, y)] += change;
+    }
+}
+
+// Recomputes wallDistance for the cells in [writeX0, writeX1] x [writeY0,
+// writeY1], looking for walls in [x0, x1] x [y0, y1]. Both are clamped to the
+// bordered grid. A forward and a backward pass over the 8 neighbours give the
+// exact Chebyshev distance.
+void buildWallDistance(int x0, int y0, int x1, int y1, int writeX0, int writeY0, int writeX1, int writeY1)
+{
+    x0 = std::max(x0, -1);
+    y0 = std::max(y0, -1);
+    x1 = std::min(x1, mapX);
+    y1 = std::min(y1, mapY);
+    int width = x1 - x0 + 1;
+    int height = y1 - y0 + 1;
+    std::vector<uint8_t> field(width * height);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            field[y * width + x] = mapGrid.walls[mapIndex(x0 + x, y0 + y)] != 0 ? 0 : wallDistanceCap;
         }
+    }
 
-        /*
-SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-SDL_RenderDrawLine(renderer, player->pos.x, player->pos.y, horizontalRayX, horizontalRayY);
-SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-SDL_RenderDrawLine(renderer, player->pos.x, player->pos.y, rayX, rayY);
-*/
-        int mappedPos;
-        int hitType;
-        // SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
-        if (distanceVertical < distanceHorizontal)
+    auto relax = [&](int x, int y, int dx, int dy)
+    {
+        int nx = x + dx;
+        int ny = y + dy;
+        if (nx >= 0 && nx < width && ny >= 0 && ny < height)
         {
-            // SDL_RenderDrawLine(renderer, player->pos.x, player->pos.y, horizontalRayX, horizontalRayY);
-            mappedPos = mappedPosVertical;
-            hitType = hitTypeVertical;
-            SDL_SetRenderDrawColor(renderer, 0, 155, 0, 255);
+            uint8_t &cell = field[y * width + x];
+            cell = std::min<int>(cell, field[ny * width + nx] + 1);
         }
-        else
+    };
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
         {
-            mappedPos = mappedPosHorizontal;
-            hitType = hitTypeHorizontal;
-            SDL_SetRenderDrawColor(renderer, 0, 100, 0, 255);
-            // SDL_RenderDrawLine(renderer, player->pos.x, player->pos.y, rayX, rayY);
+            relax(x, y, -1, 0);
+            relax(x, y, -1, -1);
+            relax(x, y, 0, -1);
+            relax(x, y, 1, -1);
         }
-
-        float distance = std::min(distanceHorizontal, distanceVertical);
-        float correctedDistance = distance * cos(degToRad(FixAngle(player->angle - rayAngle)));
-        distances[static_cast<int>(i / rayStep)] = distance;
-        SDL_FRect rectangle;
-        rectangle.x = i * (1024 / (player->FOV));
-        rectangle.h = (64 * 512) / correctedDistance;
-        rectangle.y = (512 / 2) - (rectangle.h / 2);
-        rectangle.w = (1024 / (player->FOV)) * rayStep;
-        // SDL_RenderFillRect(renderer, &rectangle);
-
-        float smallRectHeight = rectangle.h / 32;
-
-        for (int j = 0; j < 32; j++)
+    }
+    for (int y = height - 1; y >= 0; y--)
+    {
+        for (int x = width - 1; x >= 0; x--)
         {
-            uint32_t textureColorHex = textures[hitType - 1][mappedPos + j * 32];
-            Uint8 r, g, b;
-            getRGBFromTexture(hitType, mappedPos, j, r, g, b);
-            SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-            float smallRectY = rectangle.y + j * smallRectHeight;
-
-            SDL_FRect smallRect = rectangle;
-            smallRect.y = smallRectY;
-            smallRect.h = smallRectHeight;
-
-            SDL_RenderFillRectF(renderer, &smallRect);
+            relax(x, y, 1, 0);
+            relax(x, y, 1, 1);
+            relax(x, y, 0, 1);
+            relax(x, y, -1, 1);
         }
+    }
 
-        float deg = -degToRad(rayAngle);
-        float rayAngleFix = cos(degToRad(FixAngle(player->angle - rayAngle)));
-        float drawX = i * (1024 / (player->FOV));
-        float drawWidth = (1024 / (player->FOV)) * rayStep;
-        for (int y = rectangle.y + rectangle.h; y < 512; y += drawWidth / 1.5)
+    for (int y = std::max(writeY0, y0); y <= std::min(writeY1, y1); y++)
+    {
+        for (int x = std::max(writeX0, x0); x <= std::min(writeX1, x1); x++)
         {
-            float dy = y - (512 / 2.0);
-            float textureX = player->pos.x / 2 + cos(deg) * 126 * 2 * 32 / dy / rayAngleFix;
-            float textureY = player->pos.y / 2 - sin(deg) * 126 * 2 * 32 / dy / rayAngleFix;
-            int textureType = mapFloors[(int)(textureY / 32.0) * mapX + (int)(textureX / 32.0)];
-            if (textureType != 0)
-            {
-                uint8_t r, g, b;
-                getRGBFromTexture(textureType, (int)(textureX) % 32, (int)(textureY) % 32, r, g, b);
-                SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-                SDL_FRect rectangle;
-                rectangle.x = drawX;
-                rectangle.h = drawWidth;
-                rectangle.y = y;
-                rectangle.w = drawWidth;
-                SDL_RenderFillRectF(renderer, &rectangle);
-            }
-            textureX = player->pos.x / 2 + cos(deg) * 126 * 2 * 32 / dy / rayAngleFix;
-            textureY = player->pos.y / 2 - sin(deg) * 126 * 2 * 32 / dy / rayAngleFix;
-            textureType = mapCeiling[(int)(textureY / 32.0) * mapX + (int)(textureX / 32.0)];
-            if (textureType != 0)
-            {
-                Uint8 r, g, b;
-                getRGBFromTexture(textureType, (int)(textureX) % 32, (int)(textureY) % 32, r, g, b);
-                SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-                SDL_FRect rectangle;
-                rectangle.x = drawX;
-                rectangle.h = drawWidth;
-                rectangle.y = 512 - y;
-                rectangle.w = drawWidth;
-                SDL_RenderFillRectF(renderer, &rectangle);
-            }
+            mapGrid.wallDistance[mapIndex(x, y)] = field[(y - y0) * width + (x - x0)];
         }
+    }
+}
 
-        rayAngle = FixAngle(rayAngle + rayStep);
+// Must be called before writing byte index of a mapped layer, so the streamer
+// never drops the change. In the chunked layout each chunk is one tile, so the
+// chunk is the tile the index falls in.
+inline void pinMapIndex(int index)
+{
+    int chunk = index >> (2 * streamChunkShift);
+    if (mapStreamer.chunksX > 0 && chunk < mapStreamer.chunksX * mapStreamer.chunksY)
+    {
+        pinChunk(&mapStreamer, chunk);
     }
 }
 
-void drawSprites(SDL_Renderer *renderer, Player *player)
+inline void pinMapChunk(int x, int y)
 {
-    std::sort(sprites, sprites + spriteCount,
-              [player](const Sprite &a, const Sprite &b)
-              {
-                  return glm::distance(glm::vec2(a.x, a.y), glm::vec2(player->pos.x, player->pos.y)) > glm::distance(glm::vec2(b.x, b.y), glm::vec2(player->pos.x, player->pos.y));
-              });
+    pinMapIndex(mapIndex(x, y));
+}
 
-    for (int i = 0; i < spriteCount; i++)
+// Keeps the block counts and distance field in step, so opening a door can
+// empty a block. Only cells within wallDistanceCap of the change can see a
+// different distance, and their nearest walls all lie within twice that.
+inline void setMapWall(int x, int y, uint8_t wall)
+{
+    if (insideMap(x, y))
     {
-        if (sprites[i].type == Key)
+        pinMapChunk(x, y);
+        uint8_t &cell = mapGrid.walls[mapIndex(x, y)];
+        bool changed = (cell != 0) != (wall != 0);
+        cell = wall;
+        if (changed)
         {
-            float distance = sqrt(pow(sprites[i].x - player->pos.x, 2) + pow(sprites[i].y - player->pos.y, 2));
-            if (distance < 5)
+            countMapWall(x, y, wall != 0 ? 1 : -1);
+            if (!mapGrid.wallDistance.empty())
             {
-                sprites[i].active = false;
+                int reach = wallDistanceCap * 2;
+                buildWallDistance(x - reach, y - reach, x + reach, y + reach, x - wallDistanceCap, y - wallDistanceCap, x + wallDistanceCap, y + wallDistanceCap);
             }
         }
+    }
+}
 
-        if (sprites[i].type == Bomb)
+void releaseMapGrid()
+{
+    stopChunkStreamer(&mapStreamer);
+    mapStreamer.chunksX = 0;
+    mapStreamer.chunksY = 0;
+    unmapFile(&mapGrid.file);
+    std::vector<uint8_t>().swap(mapGrid.storage);
+}
+
+void setMapLayout(int tileShift)
+{
+    int tileSize = 1 << tileShift;
+    mapGrid.layout.tileShift = tileShift;
+    mapGrid.layout.tilesPerRow = (mapX + 2 + tileSize - 1) / tileSize;
+    mapGrid.layerSize = mapFileLayerSize(mapX, mapY, tileShift);
+}
+
+// Builds the block counts or distance field from the wall layer, whichever the
+// traversal mode needs. Neither is stored in map files, so a corrupt file
+// cannot make rays skip walls; DDA needs neither and loads without reading the
+// walls at all.
+void finishMapGrid(TraversalMode traversal)
+{
+    if (traversal == TraversalAuto)
+    {
+        // A map inside one coarse block has too little to skip to pay for the
+        // extra lookups.
+        traversal = std::max(mapX, mapY) + 2 > (1 << coarseBlockShift) ? TraversalBlocks : TraversalDDA;
+    }
+    mapGrid.traversal = traversal;
+
+    mapGrid.fineBlocks.clear();
+    mapGrid.coarseBlocks.clear();
+    if (traversal == TraversalBlocks)
+    {
+        mapGrid.fineBlocksPerRow = (mapX + 2 + (1 << fineBlockShift) - 1) >> fineBlockShift;
+        mapGrid.coarseBlocksPerRow = (mapX + 2 + (1 << coarseBlockShift) - 1) >> coarseBlockShift;
+        mapGrid.fineBlocks.assign(mapGrid.fineBlocksPerRow * ((mapY + 2 + (1 << fineBlockShift) - 1) >> fineBlockShift), 0);
+        mapGrid.coarseBlocks.assign(mapGrid.coarseBlocksPerRow * ((mapY + 2 + (1 << coarseBlockShift) - 1) >> coarseBlockShift), 0);
+        for (int y = -1; y <= mapY; y++)
         {
-            float distance = sqrt(pow(sprites[i].x - player->pos.x, 2) + pow(sprites[i].y - player->pos.y, 2));
-            if (distance < 15)
+            for (int x = -1; x <= mapX; x++)
             {
-                sprites[i].active = false;
-                bombCount += 1;
+                if (mapGrid.walls[mapIndex(x, y)] != 0)
+                {
+                    countMapWall(x, y, 1);
+                }
             }
         }
+    }
 
-        if (sprites[i].type == Enemy)
-        {
-
-            float deltaX = player->pos.x - sprites[i].x;
-            float deltaY = player->pos.y - sprites[i].y;
+    mapGrid.wallDistance.clear();
+    if (traversal == TraversalDistanceField)
+    {
+        mapGrid.wallDistance.assign(mapGrid.layerSize, 0);
+        buildWallDistance(-1, -1, mapX, mapY, -1, -1, mapX, mapY);
+    }
+}
 
-            float distance = std::sqrt(deltaX * deltaX + deltaY * deltaY);
-            if (distance < 10)
+// Packs the validated layers into mapGrid, in tiles of 1 << tileShift cells,
+// and builds what the traversal mode needs.
+void buildMapGrid(int tileShift, TraversalMode traversal)
+{
+    releaseMapGrid();
+    setMapLayout(tileShift);
+    int size = mapGrid.layerSize;
+    mapGrid.storage.assign(size * 3, 0);
+    mapGrid.walls = mapGrid.storage.data();
+    mapGrid.floors = mapGrid.walls + size;
+    mapGrid.ceilings = mapGrid.floors + size;
+    for (int y = -1; y <= mapY; y++)
+    {
+        for (int x = -1; x <= mapX; x++)
+        {
+            int index = mapIndex(x, y);
+            if (!insideMap(x, y))
             {
-                gameRunning = false;
+                mapGrid.walls[index] = mapOutside;
+                continue;
             }
+            mapGrid.walls[index] = map[y * mapX + x];
+            mapGrid.floors[index] = mapFloors[y * mapX + x];
+            mapGrid.ceilings[index] = mapCeiling[y * mapX + x];
+        }
+    }
+    finishMapGrid(traversal);
 
-            if (distance > 0)
-            {
-                deltaX /= distance;
-                deltaY /= distance;
+    std::vector<int>().swap(map);
+    std::vector<int>().swap(mapFloors);
+    std::vector<int>().swap(mapCeiling);
+}
 
-                float enemySpeed = 35;
-                float newX = sprites[i].x + deltaX * enemySpeed * deltaTime;
-                float newY = sprites[i].y + deltaY * enemySpeed * deltaTime;
+// Reads a legacy map.dat: two ints for the size, then each layer as a size_t
+// count followed by that many ints. Nothing in the file is trusted: sizes are
+// checked before anything is allocated, and a short file is an error.
+bool deserialize(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file)
+    {
+        std::cerr << "Error opening file for reading: " << filename << "\n";
+        return false;
+    }
 
-                int cellIndexX = floor(newX / cellWidth);
-                int cellIndexY = floor(sprites[i].y / cellWidth);
-                int mapCellIndexX = getCell(cellIndexX, cellIndexY);
+    file.read(reinterpret_cast<char *>(&mapX), sizeof(int));
+    file.read(reinterpret_cast<char *>(&mapY), sizeof(int));
+    if (!file || mapX < 1 || mapY < 1 || mapX > (int)mapFileMaxSide || mapY > (int)mapFileMaxSide)
+    {
+        std::cerr << filename << ": bad map dimensions\n";
+        return false;
+    }
 
-                if (map[mapCellIndexX] == 0)
-                {
-                    sprites[i].x = newX;
-                }
+    auto readLayer = [&](std::vector<int> &layer, const char *name)
+    {
+        size_t count;
+        file.read(reinterpret_cast<char *>(&count), sizeof(count));
+        if (!file || count > (size_t)mapX * mapY)
+        {
+            std::cerr << filename << ": bad cell count for " << name << "\n";
+            return false;
+        }
+        std::cout << "Deserializing " << name << " with count: " << count << "\n";
+        layer.resize(count);
+        file.read(reinterpret_cast<char *>(layer.data()), sizeof(int) * count);
+        if (!file)
+        {
+            std::cerr << filename << ": " << name << " is truncated\n";
+            return false;
+        }
+        return true;
+    };
+    return readLayer(map, "map") && readLayer(mapFloors, "mapFloors") && readLayer(mapCeiling, "mapCeiling");
+}
+
+// Checksum of a map file: the header up to the checksum field, then
+// everything after the header.
+uint64_t mapFileChecksum(const uint8_t *data, uint64_t size)
+{
+    uint64_t hash = fnv1a64(data, offsetof(MapFileHeader, checksum));
+    return fnv1a64(data + sizeof(MapFileHeader), size - sizeof(MapFileHeader), hash);
+}
+
+// Writes mapGrid in the current map file version. Layers start on 4 KB
+// boundaries so a mapped file keeps them page aligned, and the tiles of a
+// chunked map line up with whole pages.
+bool writeMapFile(const std::string &filename)
+{
+    MapFileHeader header = {};
+    memcpy(header.magic, mapFileMagic, sizeof(mapFileMagic));
+    header.version = mapFileVersion;
+    header.headerSize = sizeof(MapFileHeader);
+    header.width = mapX;
+    header.height = mapY;
+    header.tileShift = mapGrid.layout.tileShift;
+    header.tilesPerRow = mapGrid.layout.tilesPerRow;
+    header.layerSize = mapGrid.layerSize;
+
+    const uint8_t *layers[MapFileLayerCount] = {mapGrid.walls, mapGrid.floors, mapGrid.ceilings};
+    uint64_t alignedSize = (header.layerSize + 4095) & ~4095ull;
+    for (int layer = 0; layer < MapFileLayerCount; layer++)
+    {
+        header.layerOffsets[layer] = ((sizeof(MapFileHeader) + 4095) & ~4095ull) + layer * alignedSize;
+        for (int i = 0; i < mapGrid.layerSize; i++)
+        {
+            header.usedIds[layer][layers[layer][i] >> 6] |= 1ull << (layers[layer][i] & 63);
+        }
+    }
+    header.fileSize = header.layerOffsets[MapFileLayerCount - 1] + header.layerSize;
+
+    std::vector<uint8_t> data(header.fileSize, 0);
+    for (int layer = 0; layer < MapFileLayerCount; layer++)
+    {
+        memcpy(data.data() + header.layerOffsets[layer], layers[layer], header.layerSize);
+    }
+    memcpy(data.data(), &header, sizeof(header));
+    header.checksum = mapFileChecksum(data.data(), data.size());
+    memcpy(data.data(), &header, sizeof(header));
+
+    std::ofstream file(filename, std::ios::binary | std::ios::out);
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    if (!file)
+    {
+        std::cerr << "Error writing map file: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Clears every byte of a mapped layer that is neither 0 nor an id passing
+// validTextureId(), so a corrupt file cannot index past the texture tables.
+// The header's usedIds are not trusted; the whole layer, padding included, is
+// read in order, which costs little next to faulting its pages in. A stray
+// mapOutside inside the wall layer is left alone: rays stop on it like on the
+// border. Only bad bytes are written, so clean pages stay shared with the file.
+int validateMappedLayer(uint8_t *layer, bool walls, const char *name)
+{
+    bool valid[256];
+    for (int id = 0; id < 256; id++)
+    {
+        valid[id] = id == 0 || (walls && id == mapOutside) || validTextureId(id);
+    }
+
+    // Usable ids nearly always run from 1 up, so most blocks can be checked
+    // against a limit in a loop the compiler vectorizes; only blocks holding
+    // something past it go through the table.
+    int limit = 1;
+    while (limit < 256 && valid[limit])
+    {
+        limit++;
+    }
+    uint8_t allowed = walls ? mapOutside : 0;
+    const int blockSize = 4096;
+    int cleared = 0;
+    for (int begin = 0; begin < mapGrid.layerSize; begin += blockSize)
+    {
+        int end = std::min(begin + blockSize, mapGrid.layerSize);
+        uint8_t suspect = 0;
+        for (int i = begin; i < end; i++)
+        {
+            suspect |= (layer[i] >= limit) & (layer[i] != allowed);
+        }
+        for (int i = begin; suspect && i < end; i++)
+        {
+            if (!valid[layer[i]])
+            {
+                pinMapIndex(i);
+                layer[i] = 0;
+                cleared++;
+            }
+        }
+    }
+    if (cleared > 0)
+    {
+        std::cerr << name << ": cleared " << cleared << " cells with invalid texture ids\n";
+    }
+    return cleared;
+}
+
+// Maps a map file and points mapGrid's layers straight into it, without
+// copying. The layers are still read once to check their ids; a streamed map
+// hands those pages back before play starts. With verify set the whole file is
+// checksummed first.
+bool loadMapFile(const std::string &filename, TraversalMode traversal, bool verify)
+{
+    MappedFile mapped;
+    if (!mapFile(&mapped, filename))
+    {
+        std::cerr << "Error opening map file: " << filename << "\n";
+        return false;
+    }
+
+    MapFileHeader header;
+    std::string error;
+    if (mapped.size < sizeof(MapFileHeader))
+    {
+        error = "file is too short";
+    }
+    else
+    {
+        memcpy(&header, mapped.data, sizeof(header));
+        if (checkMapFileHeader(header, mapped.size, &error) && verify && mapFileChecksum(mapped.data, mapped.size) != header.checksum)
+        {
+            error = "checksum mismatch";
+        }
+    }
+    if (!error.empty())
+    {
+        std::cerr << filename << ": " << error << "\n";
+        unmapFile(&mapped);
+        return false;
+    }
+
+    releaseMapGrid();
+    mapGrid.file = mapped;
+    mapX = header.width;
+    mapY = header.height;
+    setMapLayout(header.tileShift);
+    mapGrid.walls = mapped.data + header.layerOffsets[MapFileWalls];
+    mapGrid.floors = mapped.data + header.layerOffsets[MapFileFloors];
+    mapGrid.ceilings = mapped.data + header.layerOffsets[MapFileCeilings];
+    if (header.tileShift == streamChunkShift)
+    {
+        uint8_t *layers[MapFileLayerCount] = {mapGrid.walls, mapGrid.floors, mapGrid.ceilings};
+        int chunksY = (mapY + 2 + (1 << streamChunkShift) - 1) >> streamChunkShift;
+        initChunkStreamer(&mapStreamer, layers, MapFileLayerCount, 1 << (2 * streamChunkShift), mapGrid.layout.tilesPerRow, chunksY);
+    }
+
+    validateMappedLayer(mapGrid.walls, true, "walls");
+    validateMappedLayer(mapGrid.floors, false, "floors");
+    validateMappedLayer(mapGrid.ceilings, false, "ceilings");
+
+    // The ray walk relies on the border to stop, so never trust the file for
+    // it. Cells are only written when wrong, keeping the pages shared.
+    for (int y = -1; y <= mapY; y++)
+    {
+        for (int x = -1; x <= mapX; x += (y == -1 || y == mapY) ? 1 : mapX + 1)
+        {
+            uint8_t &cell = mapGrid.walls[mapIndex(x, y)];
+            if (cell != mapOutside)
+            {
+                pinMapChunk(x, y);
+                cell = mapOutside;
+            }
+        }
+    }
+
+    finishMapGrid(traversal);
+    std::cout << "Mapped " << filename << ": " << mapX << "x" << mapY << "\n";
+    return true;
+}
+
+float degToRad(float angle) { return angle * M_PI / 180.0; }
+
+
+// Every pass draws into this CPU side ARGB8888 buffer, which is uploaded to a
+// single streaming texture once per frame instead of issuing a renderer call
+// for every slice and texel.
+struct Framebuffer
+{
+    int width, height;
+    std::vector<uint32_t> pixels;
+};
+
+void createFramebuffer(Framebuffer *framebuffer, int width, int height)
+{
+    framebuffer->width = width;
+    framebuffer->height = height;
+    framebuffer->pixels.assign(width * height, 0xff000000);
+}
+
+// Vertical sizes (wall heights, floor distances, sprite texels) scale with the
+// render height relative to the 512 pixel reference.
+float projectionScale(const Framebuffer *framebuffer)
+{
+    return framebuffer->height / 512.0f;
+}
+
+uint32_t packRGB(uint8_t r, uint8_t g, uint8_t b)
+{
+    return 0xff000000 | (r << 16) | (g << 8) | b;
+}
+
+void fillRect(Framebuffer *framebuffer, const SDL_FRect &rect, uint32_t color)
+{
+    int x0 = std::max(0, (int)std::lround(rect.x));
+    int y0 = std::max(0, (int)std::lround(rect.y));
+    int x1 = std::min(framebuffer->width, (int)std::lround(rect.x + rect.w));
+    int y1 = std::min(framebuffer->height, (int)std::lround(rect.y + rect.h));
+
+    for (int y = y0; y < y1; y++)
+    {
+        uint32_t *row = &framebuffer->pixels[y * framebuffer->width];
+        std::fill(row + x0, row + std::max(x0, x1), color);
+    }
+}
+
+// The texture is allocated at the full render size; when the framebuffer is
+// smaller (dynamic resolution) only its top left corner is used and stretched.
+void presentFramebuffer(Framebuffer *framebuffer, SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    SDL_Rect source = {0, 0, framebuffer->width, framebuffer->height};
+    void *pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, &source, &pixels, &pitch) == 0)
+    {
+        for (int y = 0; y < framebuffer->height; y++)
+        {
+            memcpy(static_cast<uint8_t *>(pixels) + y * pitch, &framebuffer->pixels[y * framebuffer->width], framebuffer->width * sizeof(uint32_t));
+        }
+        SDL_UnlockTexture(texture);
+    }
+    else
+    {
+        SDL_UpdateTexture(texture, &source, framebuffer->pixels.data(), framebuffer->width * sizeof(uint32_t));
+    }
+    SDL_RenderCopy(renderer, texture, &source, NULL);
+    SDL_RenderPresent(renderer);
+}
+
+void drawMap(Framebuffer *framebuffer)
+{
+    for (int y = 0; y < mapY; y++)
+    {
+        for (int x = 0; x < mapX; x++)
+        {
+            uint32_t color;
+            if (mapWall(x, y) == 1)
+            {
+                color = packRGB(255, 255, 255);
+            }
+            else
+            {
+                color = packRGB(0, 0, 0);
+            }
+
+            SDL_FRect rect;
+            rect.x = x * cellWidth;
+            rect.y = y * cellWidth;
+            rect.w = cellWidth;
+            rect.h = cellWidth;
+
+            fillRect(framebuffer, rect, color);
+        }
+    }
+}
+
+struct RayHit
+{
+    int cellX, cellY;
+    int side; // 0 = crossed a vertical grid line, 1 = crossed a horizontal grid line
+    int hitType;
+    float hitX, hitY;
+    float distance;     // along the ray, used for sprite occlusion
+    float perpDistance; // along the view direction, used for wall height
+};
+
+// DDA state of one ray. Setup and the final hit are shared by single rays and
+// packets, only the stepping loop differs.
+struct RayState
+{
+    int cellX, cellY;
+    int stepX, stepY;
+    float sideDistX, sideDistY;
+    float deltaDistX, deltaDistY;
+    int side;
+    int hitType;
+    float distance;
+};
+
+// All the per ray setup happens once up front so the loop itself is only adds
+// and compares.
+RayState startRay(const glm::vec2 &origin, const glm::vec2 &rayDir)
+{
+    RayState ray;
+    ray.cellX = floor(origin.x / cellWidth);
+    ray.cellY = floor(origin.y / cellWidth);
+    ray.side = 0;
+    ray.hitType = 0;
+    ray.distance = 10000000;
+
+    ray.deltaDistX = rayDir.x == 0 ? 1e30f : std::abs(cellWidth / rayDir.x);
+    ray.deltaDistY = rayDir.y == 0 ? 1e30f : std::abs(cellWidth / rayDir.y);
+
+    if (rayDir.x < 0)
+    {
+        ray.stepX = -1;
+        ray.sideDistX = (origin.x - ray.cellX * cellWidth) / cellWidth * ray.deltaDistX;
+    }
+    else
+    {
+        ray.stepX = 1;
+        ray.sideDistX = ((ray.cellX + 1) * cellWidth - origin.x) / cellWidth * ray.deltaDistX;
+    }
+    if (rayDir.y < 0)
+    {
+        ray.stepY = -1;
+        ray.sideDistY = (origin.y - ray.cellY * cellWidth) / cellWidth * ray.deltaDistY;
+    }
+    else
+    {
+        ray.stepY = 1;
+        ray.sideDistY = ((ray.cellY + 1) * cellWidth - origin.y) / cellWidth * ray.deltaDistY;
+    }
+    return ray;
+}
+
+inline void stepRay(RayState *ray)
+{
+    if (ray->sideDistX < ray->sideDistY)
+    {
+        ray->distance = ray->sideDistX;
+        ray->sideDistX += ray->deltaDistX;
+        ray->cellX += ray->stepX;
+        ray->side = 0;
+    }
+    else
+    {
+        ray->distance = ray->sideDistY;
+        ray->sideDistY += ray->deltaDistY;
+        ray->cellY += ray->stepY;
+        ray->side = 1;
+    }
+}
+
+// Number of grid lines crossed at sideDist + k * delta, k = 0, 1, ..., before
+// limit (up to and including it when inclusive), capped at most.
+int countCrossings(float sideDist, float delta, float limit, bool inclusive, int most)
+{
+    auto crossed = [&](int k)
+    {
+        float at = sideDist + k * delta;
+        return inclusive ? at <= limit : at < limit;
+    };
+    int count = std::max(0, std::min(most, (int)((limit - sideDist) / delta)));
+    while (count > 0 && !crossed(count - 1))
+    {
+        count--;
+    }
+    while (count < most && crossed(count))
+    {
+        count++;
+    }
+    return count;
+}
+
+// Moves the ray to the first cell past the empty box [minX, maxX] x [minY,
+// maxY] it is in, leaving it in the same state stepRay() would have after the
+// same steps. Returns the number of steps taken.
+int skipBox(RayState *ray, int minX, int maxX, int minY, int maxY)
+{
+    // Cells left until the ray crosses the box's x and y edges.
+    int stepsX = ray->stepX > 0 ? maxX + 1 - ray->cellX : ray->cellX - minX + 1;
+    int stepsY = ray->stepY > 0 ? maxY + 1 - ray->cellY : ray->cellY - minY + 1;
+    float exitX = ray->sideDistX + (stepsX - 1) * ray->deltaDistX;
+    float exitY = ray->sideDistY + (stepsY - 1) * ray->deltaDistY;
+
+    if (exitX < exitY)
+    {
+        // Every y crossing up to the x exit happens first, as stepRay() takes
+        // y on ties.
+        int crossings = countCrossings(ray->sideDistY, ray->deltaDistY, exitX, true, stepsY - 1);
+        ray->cellY += ray->stepY * crossings;
+        ray->sideDistY += crossings * ray->deltaDistY;
+        ray->cellX += ray->stepX * stepsX;
+        ray->sideDistX = exitX + ray->deltaDistX;
+        ray->distance = exitX;
+        ray->side = 0;
+        return stepsX + crossings;
+    }
+
+    int crossings = countCrossings(ray->sideDistX, ray->deltaDistX, exitY, false, stepsX - 1);
+    ray->cellX += ray->stepX * crossings;
+    ray->sideDistX += crossings * ray->deltaDistX;
+    ray->cellY += ray->stepY * stepsY;
+    ray->sideDistY = exitY + ray->deltaDistY;
+    ray->distance = exitY;
+    ray->side = 1;
+    return stepsY + crossings;
+}
+
+// Blocks are aligned to the bordered grid, so block b covers map cells
+// (b << shift) - 1 to ((b + 1) << shift) - 2.
+int skipBlock(RayState *ray, int shift)
+{
+    int blockX = (ray->cellX + 1) >> shift;
+    int blockY = (ray->cellY + 1) >> shift;
+    return skipBox(ray, (blockX << shift) - 1, ((blockX + 1) << shift) - 2, (blockY << shift) - 1, ((blockY + 1) << shift) - 2);
+}
+
+// Walks the grid one cell boundary at a time (DDA) until the ray hits a wall,
+// reaches the map border or has taken mapX + mapY steps counting the depth
+// already done. Depending on mapGrid.traversal, empty space is crossed in one
+// jump per empty block (coarse blocks first) or per clear square around the
+// cell from the distance field. The border is what stops the walk, so the loop
+// has no bounds check; only a ray starting off the map needs one, up front.
+void traverseRay(RayState *ray, int depth)
+{
+    if (!insideMap(ray->cellX, ray->cellY))
+    {
+        return;
+    }
+    while (depth < mapX + mapY)
+    {
+        int steps = 1;
+        if (mapGrid.traversal == TraversalBlocks && mapGrid.coarseBlocks[coarseBlockIndex(ray->cellX, ray->cellY)] == 0)
+        {
+            steps = skipBlock(ray, coarseBlockShift);
+        }
+        else if (mapGrid.traversal == TraversalBlocks && mapGrid.fineBlocks[fineBlockIndex(ray->cellX, ray->cellY)] == 0)
+        {
+            steps = skipBlock(ray, fineBlockShift);
+        }
+        else if (mapGrid.traversal == TraversalDistanceField && mapGrid.wallDistance[mapIndex(ray->cellX, ray->cellY)] >= 2)
+        {
+            // Every cell closer than the nearest wall is empty.
+            int clear = mapGrid.wallDistance[mapIndex(ray->cellX, ray->cellY)] - 1;
+            steps = skipBox(ray, ray->cellX - clear, ray->cellX + clear, ray->cellY - clear, ray->cellY + clear);
+        }
+        else
+        {
+            stepRay(ray);
+        }
+
+        uint8_t wall = mapGrid.walls[mapIndex(ray->cellX, ray->cellY)];
+        if (wall != 0)
+        {
+            ray->hitType = wall == mapOutside ? 0 : wall;
+            return;
+        }
+        depth += steps;
+    }
+}
+
+RayHit finishRay(const RayState &ray, const glm::vec2 &origin, const glm::vec2 &rayDir, const glm::vec2 &viewDir)
+{
+    RayHit hit;
+    hit.cellX = ray.cellX;
+    hit.cellY = ray.cellY;
+    hit.side = ray.side;
+    hit.hitType = ray.hitType;
+
+    float distance = ray.hitType == 0 ? 10000000 : ray.distance;
+    hit.hitX = origin.x + rayDir.x * distance;
+    hit.hitY = origin.y + rayDir.y * distance;
+    hit.distance = distance;
+    hit.perpDistance = distance * (rayDir.x * viewDir.x + rayDir.y * viewDir.y);
+    return hit;
+}
+
+RayHit castRay(const glm::vec2 &origin, const glm::vec2 &rayDir, const glm::vec2 &viewDir)
+{
+    RayState ray = startRay(origin, rayDir);
+    traverseRay(&ray, 0);
+    return finishRay(ray, origin, rayDir, viewDir);
+}
+
+const int rayPacketSize = 8;
+
+#ifdef RAYCASTER_AVX2
+// Once fewer rays than this are still walking, the packet stops and the rest
+// finish one at a time, so one long ray down a corridor doesn't drag seven
+// idle lanes along with it.
+const int rayPacketMinActive = 3;
+
+// Steps eight rays from the same origin in lockstep, cell by cell as in
+// TraversalDDA. The lane setup is vectorized, so distances can differ from
+// castRay() in the last bits, and a ray passing exactly through a cell corner
+// may hit the other cell.
+__attribute__((target("avx2"))) void castRayPacket(const glm::vec2 &origin, const glm::vec2 *rayDirs, const glm::vec2 &viewDir, RayHit *hits)
+{
+    alignas(32) float dirX[rayPacketSize], dirY[rayPacketSize];
+    for (int i = 0; i < rayPacketSize; i++)
+    {
+        dirX[i] = rayDirs[i].x;
+        dirY[i] = rayDirs[i].y;
+    }
+
+    // Same setup as startRay(), lane by lane. All lanes share the start cell.
+    RayState start = startRay(origin, rayDirs[0]);
+    if (!insideMap(start.cellX, start.cellY))
+    {
+        for (int i = 0; i < rayPacketSize; i++)
+        {
+            hits[i] = castRay(origin, rayDirs[i], viewDir);
+        }
+        return;
+    }
+    __m256 dirXs = _mm256_load_ps(dirX);
+    __m256 dirYs = _mm256_load_ps(dirY);
+    __m256 zeroPs = _mm256_setzero_ps();
+    __m256 width = _mm256_set1_ps(cellWidth);
+    __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 far = _mm256_set1_ps(1e30f);
+    __m256 deltaDistXs = _mm256_blendv_ps(_mm256_and_ps(_mm256_div_ps(width, dirXs), absMask), far, _mm256_cmp_ps(dirXs, zeroPs, _CMP_EQ_OQ));
+    __m256 deltaDistYs = _mm256_blendv_ps(_mm256_and_ps(_mm256_div_ps(width, dirYs), absMask), far, _mm256_cmp_ps(dirYs, zeroPs, _CMP_EQ_OQ));
+    __m256 negativeX = _mm256_cmp_ps(dirXs, zeroPs, _CMP_LT_OQ);
+    __m256 negativeY = _mm256_cmp_ps(dirYs, zeroPs, _CMP_LT_OQ);
+    __m256 sideDistXs = _mm256_blendv_ps(_mm256_set1_ps(((start.cellX + 1) * cellWidth - origin.x) / cellWidth), _mm256_set1_ps((origin.x - start.cellX * cellWidth) / cellWidth), negativeX);
+    __m256 sideDistYs = _mm256_blendv_ps(_mm256_set1_ps(((start.cellY + 1) * cellWidth - origin.y) / cellWidth), _mm256_set1_ps((origin.y - start.cellY * cellWidth) / cellWidth), negativeY);
+    sideDistXs = _mm256_mul_ps(sideDistXs, deltaDistXs);
+    sideDistYs = _mm256_mul_ps(sideDistYs, deltaDistYs);
+    __m256i stepXs = _mm256_or_si256(_mm256_castps_si256(negativeX), _mm256_set1_epi32(1));
+    __m256i stepYs = _mm256_or_si256(_mm256_castps_si256(negativeY), _mm256_set1_epi32(1));
+    __m256i cellXs = _mm256_set1_epi32(start.cellX);
+    __m256i cellYs = _mm256_set1_epi32(start.cellY);
+    __m256 distances = _mm256_set1_ps(start.distance);
+    __m256i sides = _mm256_setzero_si256();
+    __m256i hitTypes = _mm256_setzero_si256();
+    __m256i actives = _mm256_set1_epi32(-1);
+
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i byteMask = _mm256_set1_epi32(0xff);
+    __m256i outside = _mm256_set1_epi32(mapOutside);
+
+    int depth = 0;
+    while (depth < mapX + mapY && __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(actives))) >= rayPacketMinActive)
+    {
+        __m256 movesX = _mm256_cmp_ps(sideDistXs, sideDistYs, _CMP_LT_OQ);
+        __m256i movesXi = _mm256_and_si256(_mm256_castps_si256(movesX), actives);
+        __m256i movesYi = _mm256_andnot_si256(_mm256_castps_si256(movesX), actives);
+        __m256 active = _mm256_castsi256_ps(actives);
+
+        distances = _mm256_blendv_ps(distances, _mm256_blendv_ps(sideDistYs, sideDistXs, movesX), active);
+        sideDistXs = _mm256_blendv_ps(sideDistXs, _mm256_add_ps(sideDistXs, deltaDistXs), _mm256_castsi256_ps(movesXi));
+        sideDistYs = _mm256_blendv_ps(sideDistYs, _mm256_add_ps(sideDistYs, deltaDistYs), _mm256_castsi256_ps(movesYi));
+        cellXs = _mm256_add_epi32(cellXs, _mm256_and_si256(stepXs, movesXi));
+        cellYs = _mm256_add_epi32(cellYs, _mm256_and_si256(stepYs, movesYi));
+        sides = _mm256_blendv_epi8(sides, _mm256_andnot_si256(_mm256_castps_si256(movesX), one), actives);
+
+        // Byte cells read as the low byte of a 32 bit gather.
+        __m256i cells = mapLayoutIndex8(mapGrid.layout, cellXs, cellYs);
+        __m256i types = _mm256_and_si256(_mm256_mask_i32gather_epi32(zero, (const int *)mapGrid.walls, cells, actives, 1), byteMask);
+        __m256i stops = _mm256_andnot_si256(_mm256_cmpeq_epi32(types, zero), actives);
+        __m256i walls = _mm256_andnot_si256(_mm256_cmpeq_epi32(types, outside), stops);
+
+        hitTypes = _mm256_blendv_epi8(hitTypes, types, walls);
+        actives = _mm256_andnot_si256(stops, actives);
+        depth++;
+    }
+
+    RayState rays[rayPacketSize];
+    alignas(32) int cellX[rayPacketSize], cellY[rayPacketSize], stepX[rayPacketSize], stepY[rayPacketSize];
+    alignas(32) int side[rayPacketSize], hitType[rayPacketSize], active[rayPacketSize];
+    alignas(32) float sideDistX[rayPacketSize], sideDistY[rayPacketSize], deltaDistX[rayPacketSize], deltaDistY[rayPacketSize], distance[rayPacketSize];
+    _mm256_store_si256((__m256i *)cellX, cellXs);
+    _mm256_store_si256((__m256i *)cellY, cellYs);
+    _mm256_store_si256((__m256i *)side, sides);
+    _mm256_store_si256((__m256i *)hitType, hitTypes);
+    _mm256_store_si256((__m256i *)active, actives);
+    _mm256_store_ps(sideDistX, sideDistXs);
+    _mm256_store_ps(sideDistY, sideDistYs);
+    _mm256_store_ps(distance, distances);
+    _mm256_store_si256((__m256i *)stepX, stepXs);
+    _mm256_store_si256((__m256i *)stepY, stepYs);
+    _mm256_store_ps(deltaDistX, deltaDistXs);
+    _mm256_store_ps(deltaDistY, deltaDistYs);
+    // The scalar code below is not VEX encoded.
+    _mm256_zeroupper();
+    for (int i = 0; i < rayPacketSize; i++)
+    {
+        rays[i].stepX = stepX[i];
+        rays[i].stepY = stepY[i];
+        rays[i].deltaDistX = deltaDistX[i];
+        rays[i].deltaDistY = deltaDistY[i];
+        rays[i].cellX = cellX[i];
+        rays[i].cellY = cellY[i];
+        rays[i].side = side[i];
+        rays[i].hitType = hitType[i];
+        rays[i].sideDistX = sideDistX[i];
+        rays[i].sideDistY = sideDistY[i];
+        rays[i].distance = distance[i];
+        if (active[i])
+        {
+            traverseRay(&rays[i], depth);
+        }
+        hits[i] = finishRay(rays[i], origin, rayDirs[i], viewDir);
+    }
+}
+#endif
+
+// Per column values that only depend on the screen width, column count and FOV.
+// Rebuilt when any of them changes so the column loops never touch trig.
+struct ColumnTable
+{
+    int width = 0;
+    float FOV = 0;
+    int columnCount = 0;
+    float columnWidth = 0;
+    std::vector<glm::vec2> cameraDirs; // ray direction relative to the view direction
+    std::vector<float> fishEye;        // cos of the angle between ray and view direction
+    std::vector<float> tangents;       // tan of the same angle, for the floor rows
+    std::vector<int> screenX;          // column k covers [screenX[k], screenX[k + 1])
+};
+
+ColumnTable columnTable;
+
+void buildColumnTable(ColumnTable *table, int width, float FOV, int columnCount)
+{
+    table->width = width;
+    table->FOV = FOV;
+    table->columnCount = columnCount;
+    table->columnWidth = (float)width / columnCount;
+    table->cameraDirs.resize(columnCount);
+    table->fishEye.resize(columnCount);
+    table->tangents.resize(columnCount);
+    table->screenX.resize(columnCount + 1);
+    distances.assign(columnCount, 10000000);
+    wallBottoms.assign(columnCount, 0);
+
+    float angleStep = FOV / columnCount;
+    for (int column = 0; column < columnCount; column++)
+    {
+        double offset = degToRad(-FOV / 2 + column * angleStep);
+        table->cameraDirs[column] = glm::vec2(cos(offset), sin(offset));
+        table->fishEye[column] = cos(offset);
+        table->tangents[column] = tan(offset);
+    }
+    for (int column = 0; column <= table->columnCount; column++)
+    {
+        table->screenX[column] = column * width / table->columnCount;
+    }
+}
+
+// Rotates the column's camera space direction into the world by the view direction.
+glm::vec2 columnRayDir(int column, const glm::vec2 &viewDir)
+{
+    const glm::vec2 &cameraDir = columnTable.cameraDirs[column];
+    return glm::vec2(cameraDir.x * viewDir.x - cameraDir.y * viewDir.y, cameraDir.x * viewDir.y + cameraDir.y * viewDir.x);
+}
+
+// Each column only writes its own pixel range of the framebuffer and its own
+// distances[] and wallBottoms[] slots, so columns can be rendered on any thread.
+void renderWallColumn(Framebuffer *framebuffer, int column, const RayHit &hit)
+{
+    int columnX0 = columnTable.screenX[column];
+    int columnX1 = columnTable.screenX[column + 1];
+
+    int mappedPos;
+    int hitType = hit.hitType;
+    if (hit.side == 0)
+    {
+        mappedPos = static_cast<int>((hit.hitY - hit.cellY * cellWidth) / 2.0f);
+    }
+    else
+    {
+        mappedPos = static_cast<int>((hit.hitX - hit.cellX * cellWidth) / 2.0f);
+    }
+    mappedPos = glm::clamp(mappedPos, 0, 31);
+
+    float distance = hit.distance;
+    float correctedDistance = hit.perpDistance;
+    distances[column] = distance;
+    SDL_FRect rectangle;
+    rectangle.x = columnX0;
+    rectangle.h = (64 * 512 * projectionScale(framebuffer)) / correctedDistance;
+    rectangle.y = (framebuffer->height / 2) - (rectangle.h / 2);
+    rectangle.w = columnX1 - columnX0;
+
+    if (hitType >= 1 && hitType <= (int)loadedTextures.size())
+    {
+        const Texture &tex = loadedTextures[hitType - 1];
+        int level = mipLevel(tex, 32 / rectangle.h);
+        int levelHeight = tex.levels[level].height;
+        const uint32_t *texels = textureColumn(tex, level, mappedPos >> level);
+
+        // Only the rows that are on screen are written. The texel row is a 16.16
+        // fixed point value sampled at pixel centers and stepped once per row.
+        int y0 = std::max(0, (int)std::lround(rectangle.y));
+        int y1 = std::min(framebuffer->height, (int)std::lround(rectangle.y + rectangle.h));
+        float texelsPerPixel = levelHeight / rectangle.h;
+        int v = (int)((y0 + 0.5f - rectangle.y) * texelsPerPixel * 65536.0f);
+        int vStep = (int)(texelsPerPixel * 65536.0f);
+        int lastTexel = levelHeight - 1;
+        uint32_t *pixel = &framebuffer->pixels[y0 * framebuffer->width + columnX0];
+        int spanWidth = columnX1 - columnX0;
+        for (int y = y0; y < y1; y++, v += vStep, pixel += framebuffer->width)
+        {
+            uint32_t color = texels[std::min(v >> 16, lastTexel)] | 0xff000000;
+            for (int x = 0; x < spanWidth; x++)
+            {
+                pixel[x] = color;
+            }
+        }
+    }
+
+    wallBottoms[column] = rectangle.y + rectangle.h;
+}
+
+FloorRowKernel floorRowKernel = shadeFloorRowScalar;
+
+// Draws floor row y and the ceiling row mirrored above the horizon. Every
+// sample on a row is the same distance away, so the row only needs one divide:
+// a column's floor point is rowOrigin + tan(column angle) * rowStep. The colors
+// come from floorRowKernel, then get spread over each column's pixels. Pixels
+// above a column's wall bottom are left alone, and each row band writes its own
+// rows, so bands can be rendered on any thread.
+void renderFloorRow(Player *player, Framebuffer *framebuffer, const glm::vec2 &viewDir, int y)
+{
+    float dy = y - (framebuffer->height / 2.0);
+    if (dy <= 0)
+    {
+        return;
+    }
+
+    float floorScale = 126 * 2 * 32 * projectionScale(framebuffer);
+    float rowDistance = floorScale / dy;
+    glm::vec2 rowOrigin = player->pos / 2.0f + viewDir * rowDistance;
+    glm::vec2 rowStep = glm::vec2(-viewDir.y, viewDir.x) * rowDistance;
+
+    // Texels covered per screen row, from the derivative of the floor distance.
+    // Loading only keeps floor and ceiling textures of at least 32x32, so
+    // levels 0..5 always exist.
+    float footprint = rowDistance / dy;
+    int level = footprint >= 2 ? std::min(5, std::ilogb(footprint)) : 0;
+
+    thread_local std::vector<int> levelOffsets, levelShifts, levelHeights;
+    thread_local std::vector<uint32_t> floorColors, ceilingColors;
+    levelOffsets.assign(loadedTextures.size() + 1, 0);
+    levelShifts.assign(loadedTextures.size() + 1, 0);
+    levelHeights.assign(loadedTextures.size() + 1, 0);
+    for (int i = 0; i < (int)loadedTextures.size(); i++)
+    {
+        if (level < (int)loadedTextures[i].levels.size())
+        {
+            levelOffsets[i + 1] = loadedTextures[i].levels[level].texelOffset;
+            levelShifts[i + 1] = loadedTextures[i].levels[level].widthShift;
+            levelHeights[i + 1] = loadedTextures[i].levels[level].height;
+        }
+    }
+    floorColors.resize(columnTable.columnCount);
+    ceilingColors.resize(columnTable.columnCount);
+
+    FloorRowParams row;
+    row.originX = rowOrigin.x;
+    row.originY = rowOrigin.y;
+    row.stepX = rowStep.x;
+    row.stepY = rowStep.y;
+    row.y = y;
+    row.level = level;
+    row.columnCount = columnTable.columnCount;
+    row.tangents = columnTable.tangents.data();
+    row.wallBottoms = wallBottoms.data();
+    row.floors = mapGrid.floors;
+    row.ceilings = mapGrid.ceilings;
+    row.layout = mapGrid.layout;
+    row.mapX = mapX;
+    row.mapY = mapY;
+    row.atlas = textureAtlas.data();
+    row.levelOffsets = levelOffsets.data();
+    row.levelShifts = levelShifts.data();
+    row.levelHeights = levelHeights.data();
+    row.textureCount = loadedTextures.size();
+    row.floorColors = floorColors.data();
+    row.ceilingColors = ceilingColors.data();
+    floorRowKernel(row);
+
+    uint32_t *floorRow = &framebuffer->pixels[y * framebuffer->width];
+    uint32_t *ceilingRow = framebuffer->height - y < framebuffer->height ? &framebuffer->pixels[(framebuffer->height - y) * framebuffer->width] : nullptr;
+    if (columnTable.columnCount == framebuffer->width && ceilingRow)
+    {
+        for (int x = 0; x < framebuffer->width; x++)
+        {
+            floorRow[x] = floorColors[x] != 0 ? floorColors[x] : floorRow[x];
+            ceilingRow[x] = ceilingColors[x] != 0 ? ceilingColors[x] : ceilingRow[x];
+        }
+        return;
+    }
+    for (int column = 0; column < columnTable.columnCount; column++)
+    {
+        int columnX0 = columnTable.screenX[column];
+        int columnX1 = columnTable.screenX[column + 1];
+        if (floorColors[column] != 0)
+        {
+            std::fill(floorRow + columnX0, floorRow + columnX1, floorColors[column]);
+        }
+        if (ceilingColors[column] != 0 && ceilingRow)
+        {
+            std::fill(ceilingRow + columnX0, ceilingRow + columnX1, ceilingColors[column]);
+        }
+    }
+}
+
+// Columns are handed to the pool in small bands so that workers which finish
+// cheap bands (distant walls, little floor) can steal from slower ones.
+const int columnsPerBand = 8;
+const int rowsPerBand = 8;
+ThreadPool renderPool;
+
+void forEachColumnBand(int columnCount, const std::function<void(int, int)> &renderBand)
+{
+    int bandCount = (columnCount + columnsPerBand - 1) / columnsPerBand;
+    runParallel(&renderPool, bandCount, [&](int band)
+                { renderBand(band * columnsPerBand, std::min(columnCount, (band + 1) * columnsPerBand)); });
+}
+
+void forEachRow(int firstRow, int rowCount, const std::function<void(int)> &renderRow)
+{
+    int bandCount = (rowCount + rowsPerBand - 1) / rowsPerBand;
+    runParallel(&renderPool, bandCount, [&](int band)
+                {
+                    int end = std::min(rowCount, (band + 1) * rowsPerBand);
+                    for (int row = band * rowsPerBand; row < end; row++)
+                    {
+                        renderRow(firstRow + row);
+                    } });
+}
+
+// Adjacent columns nearly always walk through the same cells, so with
+// --ray-packets full groups of rayPacketSize columns are cast as one packet.
+// It is off by default: on small maps the rays are only a few steps long and
+// the packet setup costs more than the lockstep walk saves. Packets only walk
+// cell by cell, so they are skipped when the map uses block or distance field
+// traversal; otherwise each mode would render the same frames with packets on.
+void renderWallBand(Player *player, Framebuffer *framebuffer, const glm::vec2 &viewDir, int begin, int end)
+{
+    RayHit hits[columnsPerBand];
+    glm::vec2 rayDirs[columnsPerBand];
+    for (int column = begin; column < end; column++)
+    {
+        rayDirs[column - begin] = columnRayDir(column, viewDir);
+    }
+
+    int column = begin;
+#ifdef RAYCASTER_AVX2
+    bool packets = renderConfig.rayPackets && mapGrid.traversal == TraversalDDA;
+    for (; packets && column + rayPacketSize <= end; column += rayPacketSize)
+    {
+        castRayPacket(player->pos, &rayDirs[column - begin], viewDir, &hits[column - begin]);
+    }
+#endif
+    for (; column < end; column++)
+    {
+        hits[column - begin] = castRay(player->pos, rayDirs[column - begin], viewDir);
+    }
+
+    for (column = begin; column < end; column++)
+    {
+        renderWallColumn(framebuffer, column, hits[column - begin]);
+    }
+}
+
+// Walls go first so the floor/ceiling pass can start below each wall slice, and
+// the ceiling samples keep overdrawing the top edge of the wall like before.
+void raycast(Player *player, Framebuffer *framebuffer)
+{
+    int columnCount = std::max(1, (int)std::lround(framebuffer->width * renderConfig.columnsPerPixel));
+    if (columnTable.width != framebuffer->width || columnTable.FOV != player->FOV || columnTable.columnCount != columnCount)
+    {
+        buildColumnTable(&columnTable, framebuffer->width, player->FOV, columnCount);
+    }
+    glm::vec2 viewDir(cos(degToRad(player->angle)), sin(degToRad(player->angle)));
+
+    {
+        ScopedTimer timer(&profiler, StageWalls);
+        forEachColumnBand(columnTable.columnCount, [&](int begin, int end)
+                          { renderWallBand(player, framebuffer, viewDir, begin, end); });
+    }
+
+    ScopedTimer timer(&profiler, StageFloors);
+    int horizon = framebuffer->height / 2;
+    forEachRow(horizon, framebuffer->height - horizon, [&](int y)
+               { renderFloorRow(player, framebuffer, viewDir, y); });
+}
+
+void updateSprites(Player *player)
+{
+    for (int i = 0; i < spriteCount; i++)
+    {
+        if (sprites[i].type == Key)
+        {
+            float distance = sqrt(pow(sprites[i].x - player->pos.x, 2) + pow(sprites[i].y - player->pos.y, 2));
+            if (distance < 5)
+            {
+                sprites[i].active = false;
+            }
+        }
+
+        if (sprites[i].type == Bomb)
+        {
+            float distance = sqrt(pow(sprites[i].x - player->pos.x, 2) + pow(sprites[i].y - player->pos.y, 2));
+            if (distance < 15)
+            {
+                sprites[i].active = false;
+                bombCount += 1;
+            }
+        }
+
+        if (sprites[i].type == Enemy)
+        {
+
+            float deltaX = player->pos.x - sprites[i].x;
+            float deltaY = player->pos.y - sprites[i].y;
+
+            float distance = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+            if (distance < 10)
+            {
+                gameRunning = false;
+            }
+
+            if (distance > 0)
+            {
+                deltaX /= distance;
+                deltaY /= distance;
+
+                float enemySpeed = 35;
+                float newX = sprites[i].x + deltaX * enemySpeed * deltaTime;
+                float newY = sprites[i].y + deltaY * enemySpeed * deltaTime;
+
+                int cellIndexX = floor(newX / cellWidth);
+                int cellIndexY = floor(sprites[i].y / cellWidth);
+                if (mapWall(cellIndexX, cellIndexY) == 0)
+                {
+                    sprites[i].x = newX;
+                }
 
                 cellIndexX = floor(sprites[i].x / cellWidth);
                 cellIndexY = floor(newY / cellWidth);
-                int mapCellIndexY = getCell(cellIndexX, cellIndexY);
-
-                if (map[mapCellIndexY] == 0)
+                if (mapWall(cellIndexX, cellIndexY) == 0)
                 {
                     sprites[i].y = newY;
                 }
             }
         }
+    }
+}
+
+void drawSprites(Framebuffer *framebuffer, Player *player)
+{
+    {
+        ScopedTimer timer(&profiler, StageSpriteSort);
+        std::sort(sprites, sprites + spriteCount,
+                  [player](const Sprite &a, const Sprite &b)
+                  {
+                      return glm::distance(glm::vec2(a.x, a.y), glm::vec2(player->pos.x, player->pos.y)) > glm::distance(glm::vec2(b.x, b.y), glm::vec2(player->pos.x, player->pos.y));
+                  });
+    }
 
+    ScopedTimer timer(&profiler, StageSpriteDraw);
+    float scale = projectionScale(framebuffer);
+    for (int i = 0; i < spriteCount; i++)
+    {
         if (sprites[i].active == true)
         {
-            float spriteX = sprites[i].x - player->pos.x;
-            float spriteY = sprites[i].y - player->pos.y;
+            float spriteX = sprites[i].prevX + (sprites[i].x - sprites[i].prevX) * renderAlpha - player->pos.x;
+            float spriteY = sprites[i].prevY + (sprites[i].y - sprites[i].prevY) * renderAlpha - player->pos.y;
             float spriteZ = sprites[i].z;
 
             float angleRad = -degToRad(player->angle);
@@ -537,123 +1706,888 @@ void drawSprites(SDL_Renderer *renderer, Player *player)
             if (rotatedY > 0)
             {
 
-                float fovFactor = 512.0f / tan(degToRad(player->FOV / 2));
+                float fovFactor = (framebuffer->width / 2) / tan(degToRad(player->FOV / 2));
+
+                float projectedX = (rotatedX * fovFactor / rotatedY) + (framebuffer->width / 2);
+                float projectedY = (spriteZ * fovFactor / rotatedY) + (framebuffer->height / 2);
+
+                float distance = sqrt(pow(spriteX, 2) + pow(spriteY, 2));
+
+                float preCalculatedWidth = (columnTable.columnWidth + (1024.f * scale / distance)) * 0.5;
+                float preCalculatedHeight = (columnTable.columnWidth + (512.f * scale / distance)) * 0.5;
+
+                int textureIndex = 6;
+
+                if (sprites[i].type == Key)
+                {
+                    textureIndex = 6;
+                }
+
+                if (sprites[i].type == Bomb)
+                {
+                    textureIndex = 7;
+                }
+
+                if (sprites[i].type == Enemy)
+                {
+                    textureIndex = 6;
+                }
+
+                if (textureIndex >= (int)loadedTextures.size())
+                {
+                    continue;
+                }
+                const Texture &tex = loadedTextures[textureIndex];
+                float texelWidth = (256 * scale * sprites[i].scaleX) / distance;
+                float texelHeight = (256 * scale * sprites[i].scaleY) / distance;
+                int level = mipLevel(tex, 1 / std::min(texelWidth, texelHeight));
+                const TextureLevel &mip = tex.levels[level];
+                texelWidth *= 1 << level;
+                texelHeight *= 1 << level;
+                preCalculatedWidth *= 1 << level;
+                preCalculatedHeight *= 1 << level;
+
+                for (int x = 0; x < mip.width; x++)
+                {
+                    float recX = projectedX + x * texelWidth;
+                    int column = glm::clamp((int)(recX / columnTable.columnWidth), 0, columnTable.columnCount - 1);
+
+                    if (distance < distances[column])
+                    {
+
+                        const uint32_t *texels = textureColumn(tex, level, x);
+                        for (int y = 0; y < mip.height; y++)
+                        {
+                            uint32_t texel = texels[mip.height - 1 - y];
+
+                            if ((texel >> 24) != 0)
+                            {
+                                SDL_FRect rectangle;
+                                rectangle.x = recX;
+                                rectangle.y = projectedY - y * texelHeight;
+                                rectangle.w = preCalculatedWidth;
+                                rectangle.h = preCalculatedHeight;
+                                fillRect(framebuffer, rectangle, texel | 0xff000000);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void handleInput(Player *player)
+{
+    const Uint8 *keystate = SDL_GetKeyboardState(NULL);
+
+    if (keystate[SDL_SCANCODE_W])
+    {
+        int cellIndexX = floor(((player->pos.x + (moveSpeed * cos(degToRad(player->angle)) * deltaTime)) * 1.0) / cellWidth);
+        int cellIndexY = floor(((player->pos.y + (moveSpeed * sin(degToRad(player->angle)) * deltaTime)) * 1.0) / cellWidth);
+
+        if (mapWall(cellIndexX, cellIndexY) == 0)
+        {
+            player->pos.x += moveSpeed * cos(degToRad(player->angle)) * deltaTime;
+            player->pos.y += moveSpeed * sin(degToRad(player->angle)) * deltaTime;
+        }
+    }
+    if (keystate[SDL_SCANCODE_S])
+    {
+        int cellIndexX = floor(((player->pos.x - (moveSpeed * cos(degToRad(player->angle)) * 1.1 * deltaTime))) / cellWidth);
+        int cellIndexY = floor(((player->pos.y - (moveSpeed * sin(degToRad(player->angle)) * 1.1 * deltaTime))) / cellWidth);
+        if (mapWall(cellIndexX, cellIndexY) == 0)
+        {
+            player->pos.x -= moveSpeed * cos(degToRad(player->angle)) * deltaTime;
+            player->pos.y -= moveSpeed * sin(degToRad(player->angle)) * deltaTime;
+        }
+    }
+
+    if (keystate[SDL_SCANCODE_A])
+    {
+        player->angle -= rotateSpeed * deltaTime;
+    }
+    if (keystate[SDL_SCANCODE_D])
+    {
+        player->angle += rotateSpeed * deltaTime;
+    }
+
+    if (keystate[SDL_SCANCODE_E])
+    {
+
+        int cellIndexX = floor(((player->pos.x + (moveSpeed * cos(degToRad(player->angle)) * 4 * deltaTime))) / cellWidth);
+        int cellIndexY = floor(((player->pos.y + (moveSpeed * sin(degToRad(player->angle)) * 4 * deltaTime))) / cellWidth);
+
+        if (mapWall(cellIndexX, cellIndexY) == 5)
+        {
+            setMapWall(cellIndexX, cellIndexY, 0);
+        }
+    }
+}
+
+void spawnSprites()
+{
+    /*
+    Sprite key;
+    key.active = true;
+    key.type = Key;
+    key.x = 468;
+    key.y = 596;
+    key.z = 0;
+    key.width = 20;
+    key.height = 5;
+    sprites[0] = key;
+*/
+
+    Sprite enemy;
+    enemy.active = true;
+    enemy.type = Enemy;
+    enemy.x = 400;
+    enemy.y = 80;
+    enemy.z = 20;
+    sprites[0] = enemy;
+
+    enemy.x = 500;
+    sprites[1] = enemy;
+
+    enemy.x = 600;
+    enemy.scaleX = 1.2;
+    enemy.scaleY = 1.2;
+    sprites[2] = enemy;
+
+    Sprite bomb;
+    bomb.active = true;
+    bomb.type = Bomb;
+    bomb.x = 468;
+    bomb.y = 80;
+    bomb.z = 0;
+    sprites[3] = bomb;
+
+    for (int i = 0; i < spriteCount; i++)
+    {
+        sprites[i].prevX = sprites[i].x;
+        sprites[i].prevY = sprites[i].y;
+    }
+}
+
+glm::vec2 streamedPosition;
+
+// Tells the streamer where the player is and which way they are heading, in
+// chunks. Movement is measured from the previous call, so camera paths count.
+void streamAroundPlayer(const Player *player)
+{
+    if (!mapStreamer.running)
+    {
+        return;
+    }
+    glm::vec2 move = player->pos - streamedPosition;
+    streamedPosition = player->pos;
+    // Chunk coordinates count the border cell.
+    float chunkX = (player->pos.x / cellWidth + 1) / (1 << streamChunkShift);
+    float chunkY = (player->pos.y / cellWidth + 1) / (1 << streamChunkShift);
+#ifdef RAYCASTER_DEBUG
+    int cellX = std::floor(player->pos.x / cellWidth);
+    int cellY = std::floor(player->pos.y / cellWidth);
+    if ((int)std::floor(chunkX) != (cellX + 1) >> streamChunkShift || (int)std::floor(chunkY) != (cellY + 1) >> streamChunkShift)
+    {
+        std::cerr << "Streaming around chunk " << chunkX << ", " << chunkY << " for cell " << cellX << ", " << cellY << std::endl;
+    }
+#endif
+    postChunkPosition(&mapStreamer, chunkX, chunkY, move.x, move.y);
+}
+
+// Advances the game by one fixed step. Input is only read in the windowed loop.
+void stepSimulation(Player *player, bool readInput)
+{
+    deltaTime = fixedTimestep;
+    if (readInput)
+    {
+        ScopedTimer timer(&profiler, StageInput);
+        handleInput(player);
+    }
+    streamAroundPlayer(player);
+
+    ScopedTimer timer(&profiler, StageSpriteAI);
+    for (int i = 0; i < spriteCount; i++)
+    {
+        sprites[i].prevX = sprites[i].x;
+        sprites[i].prevY = sprites[i].y;
+    }
+    updateSprites(player);
+}
+
+Player interpolatePlayer(const Player &previous, const Player &current, float alpha)
+{
+    Player player = current;
+    player.pos.x = previous.pos.x + (current.pos.x - previous.pos.x) * alpha;
+    player.pos.y = previous.pos.y + (current.pos.y - previous.pos.y) * alpha;
+    player.angle = previous.angle + (current.angle - previous.angle) * alpha;
+    return player;
+}
+
+// SDL_Delay only has millisecond granularity and tends to oversleep, so sleep
+// until just before the deadline and yield for the remainder.
+void waitUntil(std::chrono::steady_clock::time_point deadline)
+{
+    while (true)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (remaining > 2)
+        {
+            SDL_Delay(remaining - 2);
+        }
+        else if (std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+void renderFrame(Player *player, Framebuffer *framebuffer)
+{
+    // drawMap(framebuffer);
+
+    SDL_FRect bottomBackground;
+    bottomBackground.x = 0;
+    bottomBackground.h = framebuffer->height / 2;
+    bottomBackground.y = framebuffer->height / 2;
+    bottomBackground.w = framebuffer->width;
+    fillRect(framebuffer, bottomBackground, packRGB(100, 100, 100));
+
+    SDL_FRect topBackground;
+    topBackground.x = 0;
+    topBackground.h = framebuffer->height / 2;
+    topBackground.y = 0;
+    topBackground.w = framebuffer->width;
+    fillRect(framebuffer, topBackground, packRGB(51, 197, 255));
+
+    raycast(player, framebuffer);
+    drawSprites(framebuffer, player);
+}
+
+const uint32_t stageColors[StageCount] = {
+    0xffffffff,
+    0xffe04040,
+    0xff40c040,
+    0xffc0c000,
+    0xffc000c0,
+    0xff4080ff,
+    0xff808080,
+    0xff000000};
+
+// Stacked bar per recent frame in the bottom left corner, one pixel per 0.1 ms,
+// with a yellow line at the 60 Hz budget. Colors follow stageColors.
+void drawProfilerOverlay(Framebuffer *framebuffer, const Profiler *profiler)
+{
+    const int graphWidth = 240;
+    const int graphHeight = 200;
+    const float pixelsPerMs = 10;
+    int left = 8;
+    int bottom = framebuffer->height - 8;
+
+    SDL_FRect background = {(float)left, (float)(bottom - graphHeight), (float)graphWidth, (float)graphHeight};
+    fillRect(framebuffer, background, 0xff101010);
+
+    for (int age = 0; age < std::min(profiler->count, graphWidth); age++)
+    {
+        const FrameSample &sample = profilerSample(profiler, age);
+        float y = bottom;
+        for (int stage = 0; stage < StageFrame; stage++)
+        {
+            float height = std::min(sample.stages[stage] * pixelsPerMs, y - (bottom - graphHeight));
+            SDL_FRect bar = {(float)(left + graphWidth - 1 - age), y - height, 1, height};
+            fillRect(framebuffer, bar, stageColors[stage]);
+            y -= height;
+        }
+    }
+
+    SDL_FRect budget = {(float)left, bottom - 1000.0f / 60.0f * pixelsPerMs, (float)graphWidth, 1};
+    fillRect(framebuffer, budget, 0xffffff00);
+}
+
+// Average of the last few frames per stage, for the window title while the
+// overlay is visible.
+std::string profilerSummary(const Profiler *profiler)
+{
+    int frames = std::min(profiler->count, 30);
+    std::string summary = "Psudo 3d Raytracer |";
+    for (int stage = 0; stage < StageCount; stage++)
+    {
+        float total = 0;
+        for (int age = 0; age < frames; age++)
+        {
+            total += profilerSample(profiler, age).stages[stage];
+        }
+        char part[48];
+        snprintf(part, sizeof(part), " %s %.2f", profileStageNames[stage], frames ? total / frames : 0);
+        summary += part;
+    }
+    return summary;
+}
+
+struct CameraKey
+{
+    float x, y, angle;
+};
+
+// Loops around the starting room of map.dat, spinning in each corner so every
+// wall, floor and ceiling texture ends up on screen.
+std::vector<CameraKey> defaultCameraPath = {
+    {80, 80, 0},
+    {80, 80, 360},
+    {200, 80, 360},
+    {200, 80, 450},
+    {200, 200, 450},
+    {200, 200, 630},
+    {80, 200, 630},
+    {80, 200, 720},
+    {80, 80, 720},
+};
+
+// Text file with one "x y angle" keyframe per line.
+bool loadCameraPath(const std::string &filename, std::vector<CameraKey> *path)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Error opening camera path: " << filename << "\n";
+        return false;
+    }
+
+    path->clear();
+    CameraKey key;
+    while (file >> key.x >> key.y >> key.angle)
+    {
+        path->push_back(key);
+    }
+    if (path->empty())
+    {
+        std::cerr << "Camera path has no keyframes: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Places the player along the path, t going from 0 at the first keyframe to 1 at
+// the last, moving at a constant rate per segment.
+void placeOnCameraPath(const std::vector<CameraKey> &path, float t, Player *player)
+{
+    float segment = t * (path.size() - 1);
+    int index = std::min((int)segment, (int)path.size() - 1);
+    int next = std::min(index + 1, (int)path.size() - 1);
+    float blend = segment - index;
+
+    player->pos.x = path[index].x + (path[next].x - path[index].x) * blend;
+    player->pos.y = path[index].y + (path[next].y - path[index].y) * blend;
+    player->angle = std::fmod(path[index].angle + (path[next].angle - path[index].angle) * blend, 360.0f);
+}
+
+// FNV-1a over the packed pixels, stable across platforms for regression checks.
+uint32_t checksumFramebuffer(const Framebuffer *framebuffer)
+{
+    uint32_t hash = 2166136261u;
+    for (uint32_t pixel : framebuffer->pixels)
+    {
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            hash ^= (pixel >> shift) & 0xff;
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+bool writePPM(const Framebuffer *framebuffer, const std::string &filename)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::out);
+    if (!file)
+    {
+        std::cerr << "Error opening file for writing: " << filename << "\n";
+        return false;
+    }
+
+    file << "P6\n"
+         << framebuffer->width << " " << framebuffer->height << "\n255\n";
+    std::vector<uint8_t> row(framebuffer->width * 3);
+    for (int y = 0; y < framebuffer->height; y++)
+    {
+        for (int x = 0; x < framebuffer->width; x++)
+        {
+            uint32_t pixel = framebuffer->pixels[y * framebuffer->width + x];
+            row[x * 3] = (pixel >> 16) & 0xff;
+            row[x * 3 + 1] = (pixel >> 8) & 0xff;
+            row[x * 3 + 2] = pixel & 0xff;
+        }
+        file.write(reinterpret_cast<char *>(row.data()), row.size());
+    }
+    return true;
+}
+
+// Scales the internal render size to keep the time spent in raycast() and
+// drawSprites() near a target. Cost is roughly proportional to pixel count, so
+// the per axis scale moves by the square root of the ratio to the target.
+struct ResolutionController
+{
+    bool enabled = false;
+    float targetMs = 12;
+    float scale = 1;
+    float minScale = 0.25f;
+    float smoothedMs = 0;
+    int cooldown = 0;
+};
+
+ResolutionController resolutionController;
 
-                float projectedX = (rotatedX * fovFactor / rotatedY) + (1024 / 2);
-                float projectedY = (spriteZ * fovFactor / rotatedY) + (512 / 2);
+float renderCost(const FrameSample &sample)
+{
+    float cost = 0;
+    for (int stage = StageWalls; stage <= StageSpriteDraw; stage++)
+    {
+        if (stage != StageSpriteAI)
+        {
+            cost += sample.stages[stage];
+        }
+    }
+    return cost;
+}
 
-                float distance = sqrt(pow(spriteX, 2) + pow(spriteY, 2));
+// Returns true when the scale changed. Small errors are ignored and changes are
+// spaced out so that a single slow frame does not make the resolution pump.
+bool updateResolutionController(ResolutionController *controller, float renderMs)
+{
+    if (controller->smoothedMs == 0)
+    {
+        controller->smoothedMs = renderMs;
+    }
+    controller->smoothedMs += (renderMs - controller->smoothedMs) * 0.1f;
 
-                float preCalculatedWidth = ((1024 / (player->FOV)) * rayStep + (1024.f / distance)) * 0.5;
-                float preCalculatedHeight = ((1024 / (player->FOV)) * rayStep + (512.f / distance)) * 0.5;
+    if (controller->cooldown > 0)
+    {
+        controller->cooldown--;
+        return false;
+    }
 
-                int textureIndex;
+    float ratio = controller->targetMs / std::max(controller->smoothedMs, 0.01f);
+    if (ratio > 0.9f && ratio < 1.1f)
+    {
+        return false;
+    }
 
-                if (sprites[i].type == Key)
-                {
-                    textureIndex = 6;
-                }
+    float scale = controller->scale * glm::clamp(std::sqrt(ratio), 0.9f, 1.1f);
+    scale = glm::clamp(scale, controller->minScale, 1.0f);
+    if (std::abs(scale - controller->scale) < 0.01f)
+    {
+        return false;
+    }
 
-                if (sprites[i].type == Bomb)
-                {
-                    textureIndex = 7;
-                }
+    controller->scale = scale;
+    controller->cooldown = 15;
+    return true;
+}
 
-                if (sprites[i].type == Enemy)
-                {
-                    textureIndex = 6;
-                }
+void applyResolutionScale(Framebuffer *framebuffer, float scale)
+{
+    int width = std::max(1, (int)std::lround(renderConfig.width * scale));
+    int height = std::max(1, (int)std::lround(renderConfig.height * scale));
+    if (width != framebuffer->width || height != framebuffer->height)
+    {
+        createFramebuffer(framebuffer, width, height);
+    }
+}
 
-                for (int x = 0; x < loadedTextures[textureIndex].width; x++)
-                {
-                    float recX = projectedX + ((x * (256 * sprites[i].scaleX)) / distance);
+struct Options
+{
+    int threadCount = std::thread::hardware_concurrency();
+    bool headless = false;
+    int frames = 0;
+    std::string dumpPrefix;
+    bool checksum = false;
+    bool benchmark = false;
+    bool vsync = false;
+    int maxFps = 60;
+    std::string cameraPath;
+    std::string profileDump;
+    int mapTileShift = -1; // -1: not given, rows for map.dat
+    TraversalMode traversal = TraversalAuto;
+    std::string mapFile; // empty: map.dat
+    std::string convertMap[2]; // legacy input and map file output
+    bool verifyMap = false;
+    bool stream = false;
+};
 
-                    if (static_cast<int>(glm::clamp((recX * 240) / 1024, 0.f, 240.f)) >= 0 && static_cast<int>(glm::clamp((recX * 240) / 1024, 0.f, 240.f)) < 241 && distance < distances[static_cast<int>(glm::clamp((recX * 240) / 1024, 0.f, 240.f))])
-                    {
+Options parseArguments(int argc, char *argv[])
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc)
+        {
+            options.threadCount = std::atoi(argv[++i]);
+        }
+        else if (arg == "--headless")
+        {
+            options.headless = true;
+        }
+        else if (arg == "--frames" && i + 1 < argc)
+        {
+            options.frames = std::atoi(argv[++i]);
+        }
+        else if (arg == "--dump-frames" && i + 1 < argc)
+        {
+            options.dumpPrefix = argv[++i];
+        }
+        else if (arg == "--checksum")
+        {
+            options.checksum = true;
+        }
+        else if (arg == "--benchmark")
+        {
+            options.benchmark = true;
+            options.headless = true;
+        }
+        else if (arg == "--camera-path" && i + 1 < argc)
+        {
+            options.cameraPath = argv[++i];
+        }
+        else if (arg == "--resolution" && i + 1 < argc)
+        {
+            sscanf(argv[++i], "%dx%d", &renderConfig.width, &renderConfig.height);
+        }
+        else if (arg == "--window" && i + 1 < argc)
+        {
+            sscanf(argv[++i], "%dx%d", &renderConfig.windowWidth, &renderConfig.windowHeight);
+        }
+        else if (arg == "--columns-per-pixel" && i + 1 < argc)
+        {
+            renderConfig.columnsPerPixel = std::atof(argv[++i]);
+        }
+        else if (arg == "--fov" && i + 1 < argc)
+        {
+            renderConfig.FOV = std::atof(argv[++i]);
+        }
+        else if (arg == "--map-layout" && i + 1 < argc)
+        {
+            std::string layout = argv[++i];
+            if (layout == "tiled")
+            {
+                options.mapTileShift = 3;
+            }
+            else if (layout == "chunked")
+            {
+                options.mapTileShift = streamChunkShift;
+            }
+            else if (layout != "rows")
+            {
+                std::cerr << "Unknown map layout: " << layout << "\n";
+            }
+        }
+        else if (arg == "--map" && i + 1 < argc)
+        {
+            options.mapFile = argv[++i];
+        }
+        else if (arg == "--convert-map" && i + 2 < argc)
+        {
+            options.convertMap[0] = argv[++i];
+            options.convertMap[1] = argv[++i];
+        }
+        else if (arg == "--verify-map")
+        {
+            options.verifyMap = true;
+        }
+        else if (arg == "--stream")
+        {
+            options.stream = true;
+        }
+        else if (arg == "--stream-budget" && i + 1 < argc)
+        {
+            options.stream = true;
+            mapStreamer.budget = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--traversal" && i + 1 < argc)
+        {
+            std::string traversal = argv[++i];
+            if (traversal == "dda")
+            {
+                options.traversal = TraversalDDA;
+            }
+            else if (traversal == "blocks")
+            {
+                options.traversal = TraversalBlocks;
+            }
+            else if (traversal == "distance")
+            {
+                options.traversal = TraversalDistanceField;
+            }
+            else
+            {
+                std::cerr << "Unknown traversal: " << traversal << "\n";
+            }
+        }
+        else if (arg == "--ray-packets")
+        {
+            renderConfig.rayPackets = true;
+        }
+        else if (arg == "--no-simd")
+        {
+            renderConfig.simd = false;
+        }
+        else if (arg == "--vsync")
+        {
+            options.vsync = true;
+        }
+        else if (arg == "--max-fps" && i + 1 < argc)
+        {
+            options.maxFps = std::atoi(argv[++i]);
+        }
+        else if (arg == "--target-frame-ms" && i + 1 < argc)
+        {
+            resolutionController.enabled = true;
+            resolutionController.targetMs = std::atof(argv[++i]);
+        }
+        else if (arg == "--min-resolution-scale" && i + 1 < argc)
+        {
+            resolutionController.minScale = glm::clamp((float)std::atof(argv[++i]), 0.05f, 1.0f);
+        }
+        else if (arg == "--profile-dump" && i + 1 < argc)
+        {
+            options.profileDump = argv[++i];
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << "\n";
+        }
+    }
+    if (options.frames <= 0)
+    {
+        options.frames = options.benchmark ? 600 : 1;
+    }
+    renderConfig.width = std::max(1, renderConfig.width);
+    renderConfig.height = std::max(1, renderConfig.height);
+    if (renderConfig.windowWidth <= 0 || renderConfig.windowHeight <= 0)
+    {
+        renderConfig.windowWidth = renderConfig.width;
+        renderConfig.windowHeight = renderConfig.height;
+    }
+    renderConfig.columnsPerPixel = glm::clamp(renderConfig.columnsPerPixel, 0.01f, 1.0f);
+    // At 180 degrees the edge rays run parallel to the view plane and walls
+    // project to infinite height.
+    renderConfig.FOV = glm::clamp(renderConfig.FOV, 1.0f, 179.0f);
+    return options;
+}
 
-                        for (int y = 0; y < loadedTextures[textureIndex].height; y++)
-                        {
-                            Uint8 r, g, b, a;
-                            getRGBFromTexture(textureIndex + 1, x, loadedTextures[textureIndex].height - 1 - y, r, g, b, a);
+// Runs the same render pipeline as the windowed loop without touching SDL video,
+// so it works on machines with no display or GPU. Simulation uses a fixed 60 Hz
+// step so frames are reproducible.
+int runHeadless(const Options &options, Player *player, Framebuffer *framebuffer)
+{
+    for (int frame = 0; frame < options.frames && gameRunning; frame++)
+    {
+        beginProfilerFrame(&profiler);
+        stepSimulation(player, false);
+        renderFrame(player, framebuffer);
+        endProfilerFrame(&profiler);
 
-                            SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-                            if (a != 0)
-                            {
-                                SDL_FRect rectangle;
-                                rectangle.x = recX;
-                                rectangle.y = projectedY - ((y * (256 * sprites[i].scaleY)) / distance);
-                                rectangle.w = preCalculatedWidth;
-                                rectangle.h = preCalculatedHeight;
-                                SDL_RenderFillRectF(renderer, &rectangle);
-                            }
-                        }
-                    }
-                }
+        if (!options.dumpPrefix.empty())
+        {
+            char suffix[16];
+            snprintf(suffix, sizeof(suffix), "%04d.ppm", frame);
+            if (!writePPM(framebuffer, options.dumpPrefix + suffix))
+            {
+                return 1;
             }
         }
+        if (options.checksum)
+        {
+            char hex[16];
+            snprintf(hex, sizeof(hex), "%08x", checksumFramebuffer(framebuffer));
+            std::cout << "frame " << frame << " checksum " << hex << "\n";
+        }
     }
+    return 0;
 }
 
-void handleInput(Player *player)
+float percentile(std::vector<float> values, float fraction)
 {
-    const Uint8 *keystate = SDL_GetKeyboardState(NULL);
+    std::sort(values.begin(), values.end());
+    int index = std::ceil(fraction * values.size()) - 1;
+    return values[glm::clamp(index, 0, (int)values.size() - 1)];
+}
 
-    if (keystate[SDL_SCANCODE_W])
+void reportTimings(const std::string &name, const std::vector<float> &values)
+{
+    char line[128];
+    snprintf(line, sizeof(line), "%-12s %9.3f %9.3f %9.3f %9.3f", name.c_str(), percentile(values, 0), percentile(values, 0.5f), percentile(values, 0.99f), percentile(values, 1));
+    std::cout << line << "\n";
+}
+
+// Replays the camera path over a fixed number of frames with a fixed 60 Hz
+// simulation step, so two runs on the same map render exactly the same frames.
+int runBenchmark(const Options &options, Player *player, Framebuffer *framebuffer)
+{
+    std::vector<CameraKey> path = defaultCameraPath;
+    if (!options.cameraPath.empty() && !loadCameraPath(options.cameraPath, &path))
     {
-        int cellIndexX = floor(((player->pos.x + (moveSpeed * cos(degToRad(player->angle)) * deltaTime)) * 1.0) / cellWidth);
-        int cellIndexY = floor(((player->pos.y + (moveSpeed * sin(degToRad(player->angle)) * deltaTime)) * 1.0) / cellWidth);
+        return 1;
+    }
 
-        int mapCellIndex = getCell(cellIndexX, cellIndexY);
+    std::vector<float> timings[StageCount];
+    for (int frame = 0; frame < options.frames; frame++)
+    {
+        placeOnCameraPath(path, options.frames > 1 ? frame / (float)(options.frames - 1) : 0, player);
 
-        if (map[mapCellIndex] == 0)
+        beginProfilerFrame(&profiler);
+        stepSimulation(player, false);
+        renderFrame(player, framebuffer);
+        const FrameSample &sample = endProfilerFrame(&profiler);
+        for (int stage = 0; stage < StageCount; stage++)
         {
-            player->pos.x += moveSpeed * cos(degToRad(player->angle)) * deltaTime;
-            player->pos.y += moveSpeed * sin(degToRad(player->angle)) * deltaTime;
+            timings[stage].push_back(sample.stages[stage]);
         }
-    }
-    if (keystate[SDL_SCANCODE_S])
-    {
-        int cellIndexX = floor(((player->pos.x - (moveSpeed * cos(degToRad(player->angle)) * 1.1 * deltaTime))) / cellWidth);
-        int cellIndexY = floor(((player->pos.y - (moveSpeed * sin(degToRad(player->angle)) * 1.1 * deltaTime))) / cellWidth);
-        int mapCellIndex = getCell(cellIndexX, cellIndexY);
 
-        if (map[mapCellIndex] == 0)
+        if (options.checksum)
         {
-            player->pos.x -= moveSpeed * cos(degToRad(player->angle)) * deltaTime;
-            player->pos.y -= moveSpeed * sin(degToRad(player->angle)) * deltaTime;
+            char hex[16];
+            snprintf(hex, sizeof(hex), "%08x", checksumFramebuffer(framebuffer));
+            std::cout << "frame " << frame << " checksum " << hex << "\n";
         }
     }
 
-    if (keystate[SDL_SCANCODE_A])
+    std::cout << "\n"
+              << options.frames << " frames, " << renderPool.queues.size() << " threads, " << framebuffer->width << "x" << framebuffer->height << "\n";
+    std::cout << "pass               min    median       p99       max  (ms)\n";
+    for (int stage = StageWalls; stage <= StageSpriteDraw; stage++)
     {
-        player->angle -= rotateSpeed * deltaTime;
+        reportTimings(profileStageNames[stage], timings[stage]);
     }
-    if (keystate[SDL_SCANCODE_D])
+    reportTimings(profileStageNames[StageFrame], timings[StageFrame]);
+    return 0;
+}
+
+// Starts streaming if it was asked for and the map allows it.
+void startMapStreaming(const Options &options, const Player *player)
+{
+    if (!options.stream)
     {
-        player->angle += rotateSpeed * deltaTime;
+        return;
+    }
+    if (mapStreamer.chunksX == 0)
+    {
+        std::cerr << "Streaming needs a map file converted with --map-layout chunked\n";
+        return;
     }
+    startChunkStreamer(&mapStreamer);
+    streamedPosition = player->pos;
+    streamAroundPlayer(player);
+    std::cout << "Streaming " << mapStreamer.chunksX << "x" << mapStreamer.chunksY << " chunks, budget " << mapStreamer.budget << "\n";
+}
 
-    if (keystate[SDL_SCANCODE_E])
+void stopMapStreaming()
+{
+    if (mapStreamer.running)
     {
+        stopChunkStreamer(&mapStreamer);
+        std::cout << "Streamed " << mapStreamer.loads << " chunks in, " << mapStreamer.evictions << " out\n";
+    }
+}
 
-        int cellIndexX = floor(((player->pos.x + (moveSpeed * cos(degToRad(player->angle)) * 4 * deltaTime))) / cellWidth);
-        int cellIndexY = floor(((player->pos.y + (moveSpeed * sin(degToRad(player->angle)) * 4 * deltaTime))) / cellWidth);
+bool endsWith(const std::string &text, const std::string &suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
 
-        int mapCellIndex = getCell(cellIndexX, cellIndexY);
+const char *mapLayoutName(int tileShift)
+{
+    return tileShift == 3 ? "tiled" : tileShift == streamChunkShift ? "chunked" : "rows";
+}
 
-        if (map[mapCellIndex] == 5)
+// Files ending in .dat are read as legacy maps, anything else is mapped.
+bool loadMap(const Options &options)
+{
+    std::string filename = options.mapFile.empty() ? "map.dat" : options.mapFile;
+    if (!endsWith(filename, ".dat"))
+    {
+        if (!loadMapFile(filename, options.traversal, options.verifyMap))
+        {
+            return false;
+        }
+        // A mapped file is used in the layout it was written with.
+        if (options.mapTileShift >= 0 && options.mapTileShift != mapGrid.layout.tileShift)
         {
-            map[mapCellIndex] = 0;
+            std::cerr << "Ignoring --map-layout " << mapLayoutName(options.mapTileShift) << ": " << filename << " is stored in the " << mapLayoutName(mapGrid.layout.tileShift) << " layout"
+                      << ", convert it again with --convert-map and --map-layout " << mapLayoutName(options.mapTileShift) << "\n";
         }
+        return true;
+    }
+    if (!deserialize(filename))
+    {
+        return false;
     }
+    validateMap(true);
+    buildMapGrid(std::max(0, options.mapTileShift), options.traversal);
+    return true;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
+    Options options = parseArguments(argc, argv);
+    startThreadPool(&renderPool, options.threadCount);
+
+    const char *floorKernelName;
+    floorRowKernel = selectFloorRowKernel(renderConfig.simd, &floorKernelName);
+    std::cout << "Floor kernel: " << floorKernelName << "\n";
+    renderConfig.rayPackets = renderConfig.rayPackets && renderConfig.simd && cpuSupportsAVX2();
 
     loadTextures();
     std::cout << loadedTextures.size();
-    deserialize("map.dat");
+    if (!options.convertMap[0].empty())
+    {
+        bool written = deserialize(options.convertMap[0]);
+        if (written)
+        {
+            validateMap(false);
+            buildMapGrid(std::max(0, options.mapTileShift), options.traversal);
+            written = writeMapFile(options.convertMap[1]);
+        }
+        stopThreadPool(&renderPool);
+        return written ? 0 : 1;
+    }
+    if (!loadMap(options))
+    {
+        stopThreadPool(&renderPool);
+        return 1;
+    }
+    if (renderConfig.rayPackets && mapGrid.traversal != TraversalDDA)
+    {
+        std::cout << "Ray packets: off, they only walk with --traversal dda\n";
+    }
+    else
+    {
+        std::cout << "Ray packets: " << (renderConfig.rayPackets ? "avx2" : "off") << "\n";
+    }
+
+    Framebuffer framebuffer;
+    createFramebuffer(&framebuffer, renderConfig.width, renderConfig.height);
+
+    Player player = {{80.0f, 80.0f}, 0.0f, renderConfig.FOV};
+    spawnSprites();
+
+    if (options.headless)
+    {
+        startMapStreaming(options, &player);
+        int result = options.benchmark ? runBenchmark(options, &player, &framebuffer) : runHeadless(options, &player, &framebuffer);
+        stopMapStreaming();
+        stopThreadPool(&renderPool);
+        if (!options.profileDump.empty())
+        {
+            dumpProfiler(&profiler, options.profileDump);
+        }
+        return result;
+    }
 
     if (SDL_Init(SDL_INIT_VIDEO) < 0)
     {
@@ -661,7 +2595,7 @@ int main()
         return 1;
     }
 
-    SDL_Window *window = SDL_CreateWindow("Psudo 3d Raytracer", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 1024, 512, SDL_WINDOW_SHOWN);
+    SDL_Window *window = SDL_CreateWindow("Psudo 3d Raytracer", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, renderConfig.windowWidth, renderConfig.windowHeight, SDL_WINDOW_SHOWN);
     if (!window)
     {
         std::cerr << "Window could not be created! SDL_Error: " << SDL_GetError() << std::endl;
@@ -669,7 +2603,7 @@ int main()
         return 1;
     }
 
-    SDL_Renderer *renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    SDL_Renderer *renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | (options.vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
     if (!renderer)
     {
         std::cerr << "Renderer could not be created! SDL_Error: " << SDL_GetError() << std::endl;
@@ -678,53 +2612,33 @@ int main()
         return 1;
     }
 
-    Player player = {{80.0f, 80.0f}, 0.0f, 60};
-    /*
-    Sprite key;
-    key.active = true;
-    key.type = Key;
-    key.x = 468;
-    key.y = 596;
-    key.z = 0;
-    key.width = 20;
-    key.height = 5;
-    sprites[0] = key;
-*/
-
-    Sprite enemy;
-    enemy.active = true;
-    enemy.type = Enemy;
-    enemy.x = 400;
-    enemy.y = 80;
-    enemy.z = 20;
-    sprites[0] = enemy;
-
-    enemy.x = 500;
-    sprites[1] = enemy;
-
-    enemy.x = 600;
-    enemy.scaleX = 1.2;
-    enemy.scaleY = 1.2;
-    sprites[2] = enemy;
-
-    Sprite bomb;
-    bomb.active = true;
-    bomb.type = Bomb;
-    bomb.x = 468;
-    bomb.y = 80;
-    bomb.z = 0;
-    sprites[3] = bomb;
+    SDL_Texture *screenTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, framebuffer.width, framebuffer.height);
+    if (!screenTexture)
+    {
+        std::cerr << "Screen texture could not be created! SDL_Error: " << SDL_GetError() << std::endl;
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
 
-    using clock = std::chrono::high_resolution_clock;
+    startMapStreaming(options, &player);
+    using clock = std::chrono::steady_clock;
     auto startTime = clock::now();
     auto lastTime = clock::now();
+    auto frameBudget = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(options.maxFps > 0 ? 1.0 / options.maxFps : 0));
+    float accumulator = 0;
+    Player previousPlayer = player;
     while (gameRunning)
     {
         auto currentTime = clock::now();
         std::chrono::duration<float> elapsed = currentTime - startTime;
-        deltaTime = ((std::chrono::duration<float>)(currentTime - lastTime)).count();
+        float frameTime = ((std::chrono::duration<float>)(currentTime - lastTime)).count();
 
         lastTime = currentTime;
+        // Clamped so a stall (window drag, breakpoint) does not queue up hundreds of steps.
+        accumulator += std::min(frameTime, 0.25f);
+        beginProfilerFrame(&profiler);
 
         // sprites[0].z = 3.0f * cos(elapsed.count() * 3);
 
@@ -735,41 +2649,63 @@ int main()
             {
                 gameRunning = false;
             }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.scancode == SDL_SCANCODE_F3)
+            {
+                profiler.overlay = !profiler.overlay;
+                if (!profiler.overlay)
+                {
+                    SDL_SetWindowTitle(window, "Psudo 3d Raytracer");
+                }
+            }
         }
 
-        handleInput(&player);
+        while (accumulator >= fixedTimestep && gameRunning)
+        {
+            previousPlayer = player;
+            stepSimulation(&player, true);
+            accumulator -= fixedTimestep;
+        }
+        renderAlpha = accumulator / fixedTimestep;
+        Player renderPlayer = interpolatePlayer(previousPlayer, player, renderAlpha);
 
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
-        // drawMap(renderer);
+        renderFrame(&renderPlayer, &framebuffer);
+        if (profiler.overlay)
+        {
+            drawProfilerOverlay(&framebuffer, &profiler);
+            if (profiler.count % 30 == 0)
+            {
+                SDL_SetWindowTitle(window, profilerSummary(&profiler).c_str());
+            }
+        }
 
-        SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);
-        SDL_Rect bottomBackground;
-        bottomBackground.x = 0;
-        bottomBackground.h = 256;
-        bottomBackground.y = 256;
-        bottomBackground.w = 1024;
-        SDL_RenderFillRect(renderer, &bottomBackground);
+        {
+            ScopedTimer timer(&profiler, StagePresent);
+            presentFramebuffer(&framebuffer, renderer, screenTexture);
+        }
+        const FrameSample &sample = endProfilerFrame(&profiler);
 
-        SDL_SetRenderDrawColor(renderer, 51, 197, 255, 255);
-        SDL_Rect topBackground;
-        topBackground.x = 0;
-        topBackground.h = 256;
-        topBackground.y = 0;
-        topBackground.w = 1024;
-        SDL_RenderFillRect(renderer, &topBackground);
+        if (resolutionController.enabled && updateResolutionController(&resolutionController, renderCost(sample)))
+        {
+            applyResolutionScale(&framebuffer, resolutionController.scale);
+        }
 
-        raycast(&player, renderer);
-        // SDL_RenderDrawPoint(renderer, static_cast<int>(player.pos.x), static_cast<int>(player.pos.y));
-        drawSprites(renderer, &player);
-        SDL_RenderPresent(renderer);
+        if (!options.vsync && options.maxFps > 0)
+        {
+            waitUntil(currentTime + frameBudget);
+        }
+    }
 
-        SDL_Delay(16);
+    if (!options.profileDump.empty())
+    {
+        dumpProfiler(&profiler, options.profileDump);
     }
 
+    stopMapStreaming();
+    stopThreadPool(&renderPool);
+    SDL_DestroyTexture(screenTexture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Map file, version 1. A MapFileHeader followed by the wall, floor and ceiling
+// layers exactly as MapGrid keeps them in memory (one byte per cell, one cell
+// border, laid out by tileShift), so a loaded file is used where it is mapped.
+// All fields are little endian and fixed size.
+const char mapFileMagic[4] = {'R', 'C', 'M', 'P'};
+const uint32_t mapFileVersion = 1;
+const uint32_t mapFileMaxSide = 32768;
+
+enum MapFileLayer
+{
+    MapFileWalls,
+    MapFileFloors,
+    MapFileCeilings,
+    MapFileLayerCount
+};
+
+struct MapFileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t width, height; // in cells, without the border
+    uint32_t tileShift;
+    uint32_t tilesPerRow;
+    uint32_t reserved;
+    uint64_t fileSize;
+    uint64_t layerSize; // bytes per layer, including slack after the cells
+    uint64_t layerOffsets[MapFileLayerCount];
+    uint64_t usedIds[MapFileLayerCount][4]; // bit n is set when id n appears in the layer; informational only
+    uint64_t checksum;                      // FNV-1a of the header up to this field, then of everything after the header
+};
+
+static_assert(sizeof(MapFileHeader) == 176, "MapFileHeader must not depend on the platform");
+
+// Bytes one layer takes for a width x height map, border and slack included.
+inline uint64_t mapFileLayerSize(uint32_t width, uint32_t height, uint32_t tileShift)
+{
+    uint64_t tileSize = 1ull << tileShift;
+    uint64_t paddedX = (width + 2 + tileSize - 1) / tileSize * tileSize;
+    uint64_t paddedY = (height + 2 + tileSize - 1) / tileSize * tileSize;
+    return paddedX * paddedY + 3;
+}
+
+// Checks everything the loader relies on before it touches a layer, so a
+// truncated or foreign file is rejected instead of read out of bounds.
+inline bool checkMapFileHeader(const MapFileHeader &header, uint64_t fileSize, std::string *error)
+{
+    if (memcmp(header.magic, mapFileMagic, sizeof(mapFileMagic)) != 0)
+    {
+        *error = "not a map file";
+        return false;
+    }
+    if (header.version != mapFileVersion || header.headerSize != sizeof(MapFileHeader))
+    {
+        *error = "unsupported map file version " + std::to_string(header.version);
+        return false;
+    }
+    if (header.fileSize != fileSize)
+    {
+        *error = "file is " + std::to_string(fileSize) + " bytes, header says " + std::to_string(header.fileSize);
+        return false;
+    }
+    if (header.width == 0 || header.height == 0 || header.width > mapFileMaxSide || header.height > mapFileMaxSide || header.tileShift > 6)
+    {
+        *error = "bad map dimensions";
+        return false;
+    }
+    uint64_t tileSize = 1ull << header.tileShift;
+    if (header.tilesPerRow != (header.width + 2 + tileSize - 1) / tileSize || header.layerSize != mapFileLayerSize(header.width, header.height, header.tileShift))
+    {
+        *error = "bad layer layout";
+        return false;
+    }
+    for (int layer = 0; layer < MapFileLayerCount; layer++)
+    {
+        if (header.layerOffsets[layer] < sizeof(MapFileHeader) || header.layerOffsets[layer] > fileSize || fileSize - header.layerOffsets[layer] < header.layerSize)
+        {
+            *error = "layer " + std::to_string(layer) + " lies outside the file";
+            return false;
+        }
+    }
+    return true;
+}
+
+inline uint64_t fnv1a64(const uint8_t *data, size_t size, uint64_t hash = 14695981039346656037ull)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// A whole file mapped copy-on-write: changes made through data (doors opening)
+// stay private to the process and never reach the file.
+struct MappedFile
+{
+    uint8_t *data = nullptr;
+    uint64_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+#endif
+};
+
+inline void unmapFile(MappedFile *mapped)
+{
+#ifdef _WIN32
+    if (mapped->data)
+    {
+        UnmapViewOfFile(mapped->data);
+    }
+    if (mapped->mapping)
+    {
+        CloseHandle(mapped->mapping);
+    }
+    if (mapped->file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(mapped->file);
+    }
+    mapped->file = INVALID_HANDLE_VALUE;
+    mapped->mapping = NULL;
+#else
+    if (mapped->data)
+    {
+        munmap(mapped->data, mapped->size);
+    }
+#endif
+    mapped->data = nullptr;
+    mapped->size = 0;
+}
+
+inline bool mapFile(MappedFile *mapped, const std::string &filename)
+{
+    unmapFile(mapped);
+#ifdef _WIN32
+    mapped->file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+    if (mapped->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(mapped->file, &size) || size.QuadPart == 0)
+    {
+        unmapFile(mapped);
+        return false;
+    }
+    mapped->mapping = CreateFileMappingA(mapped->file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    mapped->data = mapped->mapping ? static_cast<uint8_t *>(MapViewOfFile(mapped->mapping, FILE_MAP_COPY, 0, 0, 0)) : nullptr;
+    if (!mapped->data)
+    {
+        unmapFile(mapped);
+        return false;
+    }
+    mapped->size = size.QuadPart;
+#else
+    int file = open(filename.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0)
+    {
+        close(file);
+        return false;
+    }
+    void *data = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+    mapped->data = static_cast<uint8_t *>(data);
+    mapped->size = info.st_size;
+#endif
+    return true;
+}
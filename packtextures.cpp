@@ -0,0 +1,72 @@
+// Converts the PNGs in textures/ into texturepack.h so the game can start
+// without touching the disk or decoding anything. Texels are written as packed
+// ARGB8888, the format loadTextures() builds the atlas from.
+//
+// g++ -O2 packtextures.cpp -o packtextures
+// ./packtextures texturepack.h textures/texture-1.png ... textures/bomb.png
+//
+// The files must be listed in the same order as textureFilepaths in main.cpp.
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " output.h texture.png...\n";
+        return 1;
+    }
+
+    std::ofstream file(argv[1]);
+    if (!file)
+    {
+        std::cerr << "Error opening file for writing: " << argv[1] << "\n";
+        return 1;
+    }
+
+    int count = argc - 2;
+    std::vector<int> widths, heights;
+    file << "// Generated by packtextures.cpp, do not edit.\n";
+    file << "#pragma once\n#include <cstdint>\n\n";
+    file << "struct PackedTexture\n{\n    int width, height;\n    const uint32_t *texels;\n};\n\n";
+
+    for (int i = 0; i < count; i++)
+    {
+        int width, height, channels;
+        unsigned char *data = stbi_load(argv[i + 2], &width, &height, &channels, 4);
+        if (!data)
+        {
+            std::cerr << "Failed to load texture: " << argv[i + 2] << "\n";
+            return 1;
+        }
+
+        file << "// " << argv[i + 2] << "\n";
+        file << "static const uint32_t packedTexels" << i << "[" << width * height << "] = {";
+        for (int j = 0; j < width * height; j++)
+        {
+            const unsigned char *texel = &data[j * 4];
+            uint32_t argb = (texel[3] << 24) | (texel[0] << 16) | (texel[1] << 8) | texel[2];
+            char hex[16];
+            snprintf(hex, sizeof(hex), "0x%08x", argb);
+            file << (j % 8 ? " " : "\n    ") << hex << (j + 1 < width * height ? "," : "");
+        }
+        file << "};\n\n";
+
+        widths.push_back(width);
+        heights.push_back(height);
+        stbi_image_free(data);
+    }
+
+    file << "static const int packedTextureCount = " << count << ";\n";
+    file << "static const PackedTexture packedTextures[" << count << "] = {\n";
+    for (int i = 0; i < count; i++)
+    {
+        file << "    {" << widths[i] << ", " << heights[i] << ", packedTexels" << i << "}" << (i + 1 < count ? ",\n" : "};\n");
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+enum ProfileStage
+{
+    StageInput,
+    StageWalls,
+    StageFloors,
+    StageSpriteSort,
+    StageSpriteAI,
+    StageSpriteDraw,
+    StagePresent,
+    StageFrame,
+    StageCount
+};
+
+static const char *profileStageNames[StageCount] = {
+    "input",
+    "walls",
+    "floors",
+    "sprite_sort",
+    "sprite_ai",
+    "sprite_draw",
+    "present",
+    "frame"};
+
+// Milliseconds spent in each stage during one frame.
+struct FrameSample
+{
+    float stages[StageCount] = {};
+};
+
+// Keeps the last samples.size() frames; next is where the following frame goes.
+struct Profiler
+{
+    std::vector<FrameSample> samples = std::vector<FrameSample>(1024);
+    int next = 0;
+    int count = 0;
+    FrameSample current;
+    std::chrono::steady_clock::time_point frameStart;
+    bool overlay = false;
+};
+
+// Adds the time between construction and destruction to one stage of the
+// frame currently being profiled.
+struct ScopedTimer
+{
+    Profiler *profiler;
+    ProfileStage stage;
+    std::chrono::steady_clock::time_point start;
+
+    ScopedTimer(Profiler *profiler, ProfileStage stage) : profiler(profiler), stage(stage), start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer()
+    {
+        profiler->current.stages[stage] += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+inline void beginProfilerFrame(Profiler *profiler)
+{
+    profiler->current = FrameSample();
+    profiler->frameStart = std::chrono::steady_clock::now();
+}
+
+inline const FrameSample &endProfilerFrame(Profiler *profiler)
+{
+    profiler->current.stages[StageFrame] = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - profiler->frameStart).count();
+
+    FrameSample &sample = profiler->samples[profiler->next];
+    sample = profiler->current;
+    profiler->next = (profiler->next + 1) % profiler->samples.size();
+    profiler->count = std::min(profiler->count + 1, (int)profiler->samples.size());
+    return sample;
+}
+
+// age 0 is the most recently finished frame.
+inline const FrameSample &profilerSample(const Profiler *profiler, int age)
+{
+    int size = profiler->samples.size();
+    return profiler->samples[(profiler->next - 1 - age + size * 2) % size];
+}
+
+// Writes the recorded frames oldest first, as JSON if the filename ends in
+// .json and as CSV otherwise.
+inline bool dumpProfiler(const Profiler *profiler, const std::string &filename)
+{
+    std::ofstream file(filename);
+    if (!file)
+    {
+        std::cerr << "Error opening profile dump: " << filename << "\n";
+        return false;
+    }
+
+    bool json = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+    if (json)
+    {
+        file << "[\n";
+    }
+    else
+    {
+        for (int stage = 0; stage < StageCount; stage++)
+        {
+            file << (stage ? "," : "") << profileStageNames[stage];
+        }
+        file << "\n";
+    }
+
+    for (int age = profiler->count - 1; age >= 0; age--)
+    {
+        const FrameSample &sample = profilerSample(profiler, age);
+        if (json)
+        {
+            file << "  {";
+            for (int stage = 0; stage < StageCount; stage++)
+            {
+                file << (stage ? ", " : "") << "\"" << profileStageNames[stage] << "\": " << sample.stages[stage];
+            }
+            file << (age ? "},\n" : "}\n");
+        }
+        else
+        {
+            for (int stage = 0; stage < StageCount; stage++)
+            {
+                file << (stage ? "," : "") << sample.stages[stage];
+            }
+            file << "\n";
+        }
+    }
+
+    if (json)
+    {
+        file << "]\n";
+    }
+    return true;
+}
@@ -0,0 +1,1362 @@
+// Generated by packtextures.cpp, do not edit.
+#pragma once
+#include <cstdint>
+
+struct PackedTexture
+{
+    int width, height;
+    const uint32_t *texels;
+};
+
+// textures/texture-1.png
+static const uint32_t packedTexels0[1024] = {
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff000000};
+
+// textures/texture-2.png
+static const uint32_t packedTexels1[1024] = {
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700, 0xff5f2700,
+    0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700, 0xffb93400, 0xffb93400, 0xffb93400,
+    0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xffb93400, 0xff5f2700};
+
+// textures/texture-3.png
+static const uint32_t packedTexels2[1024] = {
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff412700, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff583400,
+    0xff583400, 0xff583400, 0xff583400, 0xff583400, 0xff412700, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700, 0xff412700,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100,
+    0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff6e4100, 0xff412700, 0xff583400};
+
+// textures/texture-4.png
+static const uint32_t packedTexels3[1024] = {
+    0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xffb00000, 0xff585858, 0xffb00000,
+    0xffb00000, 0xff585858, 0xffb00000, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xffb00000, 0xff9b0000,
+    0xff9b0000, 0xffb00000, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff6b6b6b, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xffb00000, 0xff9b0000, 0xffb00000,
+    0xffb00000, 0xff9b0000, 0xffb00000, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xffb00000, 0xff9b0000, 0xffb00000,
+    0xffb00000, 0xff9b0000, 0xffb00000, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xffb00000, 0xff9b0000,
+    0xff9b0000, 0xffb00000, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xffb00000, 0xff585858, 0xffb00000,
+    0xffb00000, 0xff585858, 0xffb00000, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff6b6b6b, 0xff585858,
+    0xff6b6b6b, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff6b6b6b, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e,
+    0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff3e3e3e, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858,
+    0xff585858, 0xff585858, 0xff6b6b6b, 0xff585858, 0xff585858, 0xff585858, 0xff585858, 0xff585858};
+
+// textures/texture-5.png
+static const uint32_t packedTexels4[1024] = {
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff8c0000, 0xff8c0000, 0xff8c0000,
+    0xff8c0000, 0xff8c0000, 0xff8c0000, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xffffc300, 0xffffc300, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xffffc300, 0xffffc300, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xffffc300, 0xffffc300, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xffffc300, 0xffffc300, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xffffc300, 0xffffc300, 0xff505050, 0xff505050, 0xff505050,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff404040, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050,
+    0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff505050, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040,
+    0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040, 0xff404040};
+
+// textures/texture-6.png
+static const uint32_t packedTexels5[1024] = {
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff4f4f4f, 0xff4f4f4f,
+    0xff4f4f4f, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff727272, 0xff727272, 0xff727272, 0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272,
+    0xff4f4f4f, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272, 0xff727272};
+
+// textures/Enemy-Placeholder.png
+static const uint32_t packedTexels6[4000] = {
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000};
+
+// textures/bomb.png
+static const uint32_t packedTexels7[400] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff0d0d0d, 0xff111111, 0xff000000, 0xff0d0d0d,
+    0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff111111, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff111111, 0xffe40000, 0xffe40000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xffe40000, 0xffe40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xff000000, 0xff000000, 0xff000000, 0xff0d0d0d, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff111111, 0xff060606, 0xff111111, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000,
+    0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff0d0d0d, 0xff0d0d0d, 0xff000000, 0xff060606, 0xff060606,
+    0xff060606, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff0d0d0d,
+    0xff000000, 0xff0d0d0d, 0xff0d0d0d, 0xff000000, 0xff060606, 0xff000000, 0xff000000, 0xff0d0d0d,
+    0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff1a1a1a,
+    0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000, 0xff060606, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff111111, 0xff060606, 0xff0d0d0d, 0xff000000, 0xff000000, 0x00000000, 0x00000000,
+    0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000,
+    0xff0d0d0d, 0xff060606, 0xff000000, 0xff000000, 0xff060606, 0xff000000, 0xff060606, 0xff060606,
+    0xff060606, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a,
+    0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000, 0xff0d0d0d, 0xff0d0d0d, 0xff111111, 0xff060606,
+    0xff000000, 0xff060606, 0xff111111, 0xff000000, 0xff000000, 0xff060606, 0xff000000, 0x00000000,
+    0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000,
+    0xff000000, 0xff0d0d0d, 0xff000000, 0xff060606, 0xff111111, 0xff000000, 0xff000000, 0xff0d0d0d,
+    0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff111111, 0xff000000, 0xff1a1a1a,
+    0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000, 0xff111111, 0xff060606, 0xff060606, 0xff000000,
+    0xff000000, 0xff000000, 0xff0d0d0d, 0xff060606, 0xff000000, 0xff111111, 0xff000000, 0x00000000,
+    0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff292929, 0xff1a1a1a, 0xff1a1a1a, 0xff000000,
+    0xff060606, 0xff000000, 0xff000000, 0xff111111, 0xff000000, 0xff000000, 0xff000000, 0xff060606,
+    0xff060606, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a,
+    0xff292929, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000, 0xff0d0d0d, 0xff0d0d0d,
+    0xff0d0d0d, 0xff000000, 0xff000000, 0xff060606, 0xff111111, 0xff000000, 0xff000000, 0x00000000,
+    0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff292929, 0xff1a1a1a, 0xff1a1a1a,
+    0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff111111,
+    0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000,
+    0xff1a1a1a, 0xff292929, 0xff292929, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a,
+    0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a, 0xff1a1a1a, 0xff292929,
+    0xff292929, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000,
+    0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xff000000, 0xff000000, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff292929, 0xff292929, 0xff1a1a1a,
+    0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff1a1a1a,
+    0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff1a1a1a, 0xff000000, 0xff000000, 0xff000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xff111111, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000};
+
+static const int packedTextureCount = 8;
+static const PackedTexture packedTextures[8] = {
+    {32, 32, packedTexels0},
+    {32, 32, packedTexels1},
+    {32, 32, packedTexels2},
+    {32, 32, packedTexels3},
+    {32, 32, packedTexels4},
+    {32, 32, packedTexels5},
+    {40, 100, packedTexels6},
+    {20, 20, packedTexels7}};
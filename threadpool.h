@@ -0,0 +1,158 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <algorithm>
+
+// Range of task indices still owned by one participant. The owner takes from the
+// front, idle participants steal from the back.
+struct WorkQueue
+{
+    std::mutex mutex;
+    int begin = 0;
+    int end = 0;
+};
+
+// Persistent pool of worker threads. The thread calling runParallel() takes part
+// as participant 0, so a pool with no workers simply runs everything inline.
+struct ThreadPool
+{
+    std::vector<std::thread> workers;
+    std::vector<WorkQueue> queues;
+    std::function<void(int)> task;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    int generation = 0;
+    int busyWorkers = 0;
+    bool stopping = false;
+};
+
+inline int popTask(WorkQueue &queue)
+{
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.begin < queue.end)
+    {
+        return queue.begin++;
+    }
+    return -1;
+}
+
+inline int stealTask(ThreadPool *pool, int self)
+{
+    int count = pool->queues.size();
+    for (int i = 1; i < count; i++)
+    {
+        WorkQueue &victim = pool->queues[(self + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.begin < victim.end)
+        {
+            return --victim.end;
+        }
+    }
+    return -1;
+}
+
+inline void participate(ThreadPool *pool, int self)
+{
+    while (true)
+    {
+        int task = popTask(pool->queues[self]);
+        if (task == -1)
+        {
+            task = stealTask(pool, self);
+        }
+        if (task == -1)
+        {
+            return;
+        }
+        pool->task(task);
+    }
+}
+
+inline void workerLoop(ThreadPool *pool, int self)
+{
+    int seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    while (true)
+    {
+        pool->wake.wait(lock, [&]
+                        { return pool->stopping || pool->generation != seenGeneration; });
+        if (pool->stopping)
+        {
+            return;
+        }
+        seenGeneration = pool->generation;
+
+        lock.unlock();
+        participate(pool, self);
+        lock.lock();
+
+        if (--pool->busyWorkers == 0)
+        {
+            pool->done.notify_one();
+        }
+    }
+}
+
+// threadCount includes the calling thread.
+inline void startThreadPool(ThreadPool *pool, int threadCount)
+{
+    threadCount = std::max(1, threadCount);
+    pool->queues = std::vector<WorkQueue>(threadCount);
+    for (int i = 1; i < threadCount; i++)
+    {
+        pool->workers.emplace_back(workerLoop, pool, i);
+    }
+}
+
+inline void stopThreadPool(ThreadPool *pool)
+{
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->stopping = true;
+    }
+    pool->wake.notify_all();
+    for (auto &worker : pool->workers)
+    {
+        worker.join();
+    }
+    pool->workers.clear();
+}
+
+// Runs task(0) .. task(taskCount - 1) across the pool and returns once all of them
+// have finished. Each participant starts on its own contiguous slice of the range.
+inline void runParallel(ThreadPool *pool, int taskCount, const std::function<void(int)> &task)
+{
+    if (pool->queues.empty())
+    {
+        for (int i = 0; i < taskCount; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    int participants = pool->queues.size();
+    for (int i = 0; i < participants; i++)
+    {
+        pool->queues[i].begin = i * taskCount / participants;
+        pool->queues[i].end = (i + 1) * taskCount / participants;
+    }
+    pool->task = task;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->busyWorkers = pool->workers.size();
+        pool->generation++;
+    }
+    pool->wake.notify_all();
+
+    participate(pool, 0);
+
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    pool->done.wait(lock, [&]
+                    { return pool->busyWorkers == 0; });
+}